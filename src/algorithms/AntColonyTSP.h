@@ -0,0 +1,308 @@
+#ifndef ANTCOLONYTSP_H
+#define ANTCOLONYTSP_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+
+#include "core/TSPAlgorithm.h"
+#include "core/AlignedAllocator.h"
+#include "core/CandidateLists.h"
+#include "core/TourArray.h"
+#include "core/ThreadPool.h"
+#include "core/FastRandom.h"
+#include "algorithms/NearestNeighborTSP.h"
+#include "algorithms/LocalSearch.h"
+#include "algorithms/LocalSearchMoves.h"
+
+/**
+ * @brief Colônia de formigas MAX-MIN Ant System (MMAS)
+ *
+ * Feromônio e heurística ficam em matrizes planas n x k alinhadas à linha
+ * de cache, restritas às listas de candidatos (a entrada [i*k + s] é a
+ * aresta de i para o s-ésimo vizinho de i). A evaporação, o limite mínimo
+ * e o produto feromônio x heurística são passadas lineares sobre esses
+ * arrays, que o compilador vetoriza.
+ *
+ * As formigas constroem rotas em paralelo no ThreadPool (cada uma com seu
+ * gerador derivado de semente, iteração e índice); quando todos os
+ * candidatos já foram visitados, a formiga segue para a cidade não
+ * visitada mais próxima. Cada rota passa por busca local (2-opt + Or-opt)
+ * e a melhor da iteração (ou a melhor global, periodicamente) deposita
+ * feromônio, sempre dentro dos limites [tau_min, tau_max] do MMAS.
+ *
+ * Parâmetros (setParameters): ants, alpha, beta, rho, time_limit_ms,
+ * max_iterations, neighbor_count, local_search, seed, threads.
+ */
+class AntColonyTSP : public TSPAlgorithm {
+private:
+    size_t m_ants;
+    double m_alpha;
+    double m_beta;
+    double m_rho;
+    long m_timeLimitMs;
+    size_t m_maxIterations;
+    size_t m_neighborCount;
+    bool m_localSearch;
+    uint64_t m_seed;
+    unsigned m_threads;
+
+    size_t m_iterations;
+    double m_totalIterationMs;
+    double m_lastIterationMs;
+
+    static constexpr size_t GLOBAL_BEST_PERIOD = 5;   ///< A cada quantas iterações deposita a melhor global
+
+    /// Estado de trabalho de cada participante do pool
+    struct Worker {
+        std::vector<uint32_t> stamp;
+        uint32_t token = 0;
+        std::vector<uint32_t> unvisited;
+        std::vector<uint32_t> slot;      ///< Posição da cidade em unvisited
+        std::vector<double> weights;
+        TourArray tour;
+        LocalSearch search;
+    };
+
+    static void evaporate(double* tau, size_t count, double keep, double tauMin) {
+        for (size_t i = 0; i < count; ++i) tau[i] = std::max(tau[i] * keep, tauMin);
+    }
+
+    void updateChoice(const double* tau, const double* eta, double* choice, size_t count) const {
+        if (m_alpha == 1.0) {
+            for (size_t i = 0; i < count; ++i) choice[i] = tau[i] * eta[i];
+        } else {
+            for (size_t i = 0; i < count; ++i) choice[i] = std::pow(tau[i], m_alpha) * eta[i];
+        }
+    }
+
+    static double tourLength(const DistanceMatrix& dist, const uint32_t* tour, size_t n) {
+        double total = dist.at(tour[n - 1], tour[0]);
+        for (size_t i = 0; i + 1 < n; ++i) total += dist.at(tour[i], tour[i + 1]);
+        return total;
+    }
+
+    /**
+     * @brief Constrói a rota de uma formiga pela regra proporcional
+     */
+    static void construct(uint32_t* tour, size_t n, const CandidateLists& candidates,
+                          const double* choice, const DistanceMatrix& dist,
+                          FastRandom& rng, Worker& w) {
+        const size_t k = candidates.k();
+        if (++w.token == 0) {
+            std::fill(w.stamp.begin(), w.stamp.end(), 0);
+            w.token = 1;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            w.unvisited[i] = static_cast<uint32_t>(i);
+            w.slot[i] = static_cast<uint32_t>(i);
+        }
+        size_t remaining = n;
+        auto visit = [&](uint32_t city) {
+            w.stamp[city] = w.token;
+            uint32_t last = w.unvisited[--remaining];
+            w.unvisited[w.slot[city]] = last;
+            w.slot[last] = w.slot[city];
+        };
+
+        uint32_t current = rng.uniform(static_cast<uint32_t>(n));
+        tour[0] = current;
+        visit(current);
+        for (size_t step = 1; step < n; ++step) {
+            const uint32_t* neighbors = candidates.of(current);
+            const double* row = choice + size_t(current) * k;
+            double sum = 0.0;
+            for (size_t s = 0; s < k; ++s) {
+                double weight = w.stamp[neighbors[s]] == w.token ? 0.0 : row[s];
+                w.weights[s] = weight;
+                sum += weight;
+            }
+
+            uint32_t next = current;
+            if (sum > 0.0) {
+                double r = rng.uniformReal() * sum;
+                size_t s = 0;
+                for (; s + 1 < k; ++s) {
+                    if (w.weights[s] > 0.0 && (r -= w.weights[s]) <= 0.0) break;
+                }
+                while (w.weights[s] == 0.0) --s;   // proteção contra arredondamento
+                next = neighbors[s];
+            } else {
+                // Todos os candidatos visitados: cidade livre mais próxima
+                double best = std::numeric_limits<double>::max();
+                for (size_t i = 0; i < remaining; ++i) {
+                    double d = dist.at(current, w.unvisited[i]);
+                    if (d < best) { best = d; next = w.unvisited[i]; }
+                }
+            }
+            tour[step] = next;
+            visit(next);
+            current = next;
+        }
+    }
+
+public:
+    explicit AntColonyTSP(size_t ants = 20, long timeLimitMs = 1000)
+        : m_ants(ants), m_alpha(1.0), m_beta(2.0), m_rho(0.2), m_timeLimitMs(timeLimitMs),
+          m_maxIterations(0), m_neighborCount(15), m_localSearch(true), m_seed(12345), m_threads(0),
+          m_iterations(0), m_totalIterationMs(0.0), m_lastIterationMs(0.0) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        if (m_ants == 0) throw TSPException("Invalid parameter: ants");
+        if (m_rho <= 0.0 || m_rho >= 1.0) throw TSPException("Invalid parameter: rho");
+        if (m_timeLimitMs <= 0 && m_maxIterations == 0) {
+            throw TSPException("Invalid parameter: time_limit_ms");
+        }
+        m_iterations = 0;
+        m_totalIterationMs = m_lastIterationMs = 0.0;
+
+        const size_t n = graph.size();
+        Route seedRoute = NearestNeighborTSP().solve(graph);
+        if (n < 5) {
+            recordExecutionTime(start);
+            return seedRoute;
+        }
+
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        CandidateLists candidates(graph, m_neighborCount, m_threads);
+        const size_t k = candidates.k();
+        const size_t cells = n * k;
+
+        // Heurística eta^beta e feromônio inicial tau_max (a partir da rota NN)
+        AlignedVector<double> tau(cells), eta(cells), choice(cells);
+        for (size_t i = 0; i < n; ++i) {
+            const uint32_t* neighbors = candidates.of(static_cast<uint32_t>(i));
+            for (size_t s = 0; s < k; ++s) {
+                double d = std::max(dist.at(i, neighbors[s]), 1e-12);
+                eta[i * k + s] = std::pow(1.0 / d, m_beta);
+            }
+        }
+
+        std::vector<uint32_t> bestTour = seedRoute.getSequence();
+        double bestLength = seedRoute.getTotalDistance();
+        double tauMax = 1.0 / (m_rho * bestLength);
+        // Limite inferior do MMAS com p_best = 0.05 e k/2 escolhas médias
+        double pRoot = std::pow(0.05, 1.0 / n);
+        double tauRatio = (1.0 - pRoot) / ((std::max<double>(k, 2) / 2.0 - 1.0 + 1e-9) * pRoot);
+        double tauMin = tauMax * std::min(tauRatio, 1.0);
+        std::fill(tau.begin(), tau.end(), tauMax);
+        updateChoice(tau.data(), eta.data(), choice.data(), cells);
+
+        ThreadPool pool(m_threads);
+        std::vector<Worker> workers(pool.size());
+        for (auto& w : workers) {
+            w.stamp.assign(n, 0);
+            w.unvisited.resize(n);
+            w.slot.resize(n);
+            w.weights.resize(k);
+            w.search.addMove(std::make_unique<TwoOptMove>());
+            w.search.addMove(std::make_unique<OrOptMove>());
+        }
+        std::vector<uint32_t> tours(m_ants * n);
+        std::vector<double> lengths(m_ants);
+
+        auto deposit = [&](const uint32_t* tour, double length) {
+            double amount = 1.0 / length;
+            for (size_t i = 0; i < n; ++i) {
+                uint32_t a = tour[i], b = tour[(i + 1) % n];
+                for (int side = 0; side < 2; ++side) {
+                    const uint32_t* neighbors = candidates.of(a);
+                    for (size_t s = 0; s < k; ++s) {
+                        if (neighbors[s] != b) continue;
+                        double& cell = tau[size_t(a) * k + s];
+                        cell = std::min(cell + amount, tauMax);
+                        break;
+                    }
+                    std::swap(a, b);
+                }
+            }
+        };
+
+        auto deadline = start + std::chrono::milliseconds(m_timeLimitMs);
+        while ((m_maxIterations == 0 || m_iterations < m_maxIterations) &&
+               (m_timeLimitMs <= 0 || Clock::now() < deadline)) {
+            auto iterationStart = Clock::now();
+            const uint64_t iteration = m_iterations + 1;
+
+            pool.parallelFor(m_ants, [&](size_t ant, unsigned participant) {
+                Worker& w = workers[participant];
+                uint32_t* tour = tours.data() + ant * n;
+                FastRandom rng(FastRandom::mix(m_seed, iteration, ant));
+                construct(tour, n, candidates, choice.data(), dist, rng, w);
+                if (m_localSearch) {
+                    w.tour.assign(tour, n);
+                    w.search.run(w.tour, dist, candidates);
+                    std::copy(w.tour.order().begin(), w.tour.order().end(), tour);
+                }
+                lengths[ant] = tourLength(dist, tour, n);
+            });
+
+            size_t iterationBest = 0;
+            for (size_t ant = 1; ant < m_ants; ++ant) {
+                if (lengths[ant] < lengths[iterationBest]) iterationBest = ant;
+            }
+            const uint32_t* bestOfIteration = tours.data() + iterationBest * n;
+            if (lengths[iterationBest] < bestLength) {
+                bestLength = lengths[iterationBest];
+                bestTour.assign(bestOfIteration, bestOfIteration + n);
+                tauMax = 1.0 / (m_rho * bestLength);
+                tauMin = tauMax * std::min(tauRatio, 1.0);
+            }
+
+            // Evaporação + limite mínimo, depósito e atualização das escolhas
+            evaporate(tau.data(), cells, 1.0 - m_rho, tauMin);
+            if (iteration % GLOBAL_BEST_PERIOD == 0) deposit(bestTour.data(), bestLength);
+            else deposit(bestOfIteration, lengths[iterationBest]);
+            updateChoice(tau.data(), eta.data(), choice.data(), cells);
+
+            m_lastIterationMs = std::chrono::duration<double, std::milli>(Clock::now() - iterationStart).count();
+            m_totalIterationMs += m_lastIterationMs;
+            ++m_iterations;
+        }
+
+        TourArray result(bestTour);
+        Route route(graph, result.orderFrom(0));
+        recordExecutionTime(start);
+        return route;
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "ants") m_ants = static_cast<size_t>(value);
+            else if (key == "alpha") m_alpha = value;
+            else if (key == "beta") m_beta = value;
+            else if (key == "rho") m_rho = value;
+            else if (key == "time_limit_ms") m_timeLimitMs = static_cast<long>(value);
+            else if (key == "max_iterations") m_maxIterations = static_cast<size_t>(value);
+            else if (key == "neighbor_count") m_neighborCount = static_cast<size_t>(value);
+            else if (key == "local_search") m_localSearch = value != 0.0;
+            else if (key == "seed") m_seed = static_cast<uint64_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+        }
+    }
+
+    /// Limite de tempo em ms (0 = apenas max_iterations)
+    void setTimeLimit(long milliseconds) { m_timeLimitMs = milliseconds; }
+
+    size_t getIterations() const { return m_iterations; }
+    /// Tempo médio de uma iteração (ms)
+    double getAverageIterationTime() const {
+        return m_iterations ? m_totalIterationMs / m_iterations : 0.0;
+    }
+    double getLastIterationTime() const { return m_lastIterationMs; }
+
+    std::string getName() const override { return "Ant Colony (MMAS)"; }
+    std::string getDescription() const override {
+        return "MAX-MIN Ant System over candidate lists with local search";
+    }
+};
+
+#endif // ANTCOLONYTSP_H
@@ -0,0 +1,236 @@
+#ifndef BRUTEFORCETSP_H
+#define BRUTEFORCETSP_H
+
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <cstdint>
+#include <cmath>
+
+#include "core/TSPAlgorithm.h"
+
+/**
+ * @brief Algoritmo Brute Force para TSP
+ *
+ * Busca exaustiva com a cidade 0 fixa e eliminação da simetria de reversão
+ * (só são completadas rotas em que a segunda cidade tem índice menor que a
+ * última). O espaço de permutações é dividido em unidades de trabalho por
+ * prefixo, consumidas por todas as threads; caminhos parciais cujo limite
+ * inferior já excede o melhor limite global são podados. O limite é
+ * compartilhado via std::atomic (sem locks).
+ *
+ * O limite inferior soma ao caminho a menor aresta de saída da cidade
+ * atual e de cada cidade ainda não visitada (cada uma ainda precisa de uma
+ * aresta de saída), o que vale para qualquer matriz, inclusive EXPLICIT e
+ * métricas arredondadas, que podem violar a desigualdade triangular. Só na
+ * métrica euclidiana sem arredondamento usa-se também a volta direta até 0.
+ *
+ * Entre rotas de mesmo comprimento vence a lexicograficamente menor, então
+ * o resultado não depende da ordem de execução das threads.
+ */
+class BruteForceTSP : public TSPAlgorithm {
+private:
+    size_t m_maxPoints;
+    unsigned m_threads;
+    uint64_t m_nodesExplored;
+
+    static constexpr size_t PREFIX_DEPTH = 3;
+
+    struct Search {
+        const std::vector<double>& dist;
+        const std::vector<double>& minOut;   ///< Menor aresta de saída de cada cidade
+        bool triangle;                       ///< Volta direta até 0 é limite inferior
+        size_t n;
+        std::atomic<double>& bound;
+        std::vector<uint32_t> path;
+        std::vector<uint32_t> best;
+        double bestLength;
+        uint64_t nodes;
+
+        Search(const std::vector<double>& d, const std::vector<double>& out, bool metric,
+               size_t count, std::atomic<double>& b)
+            : dist(d), minOut(out), triangle(metric), n(count), bound(b), path(count),
+              bestLength(std::numeric_limits<double>::max()), nodes(0) {}
+
+        double at(uint32_t a, uint32_t b) const { return dist[a * n + b]; }
+
+        /**
+         * @brief Poda: caminho até c com comprimento extended, sendo
+         *        remaining a soma de minOut das cidades não visitadas antes de c
+         *
+         * Faltam as saídas de c e das demais não visitadas: extended + remaining.
+         * Empates não são podados, para manter o desempate lexicográfico.
+         */
+        bool prune(uint32_t c, double extended, double remaining) const {
+            double lower = extended + remaining;
+            if (triangle) lower = std::max(lower, extended + at(c, 0));
+            // Folga relativa: a soma incremental de remaining acumula arredondamento
+            return lower - 1e-12 * std::abs(lower) > bound.load(std::memory_order_relaxed);
+        }
+
+        void offer(double length) {
+            if (length < bestLength || (length == bestLength && path < best)) {
+                bestLength = length;
+                best = path;
+            }
+            // Atualização sem lock do limite global (mínimo atômico)
+            double current = bound.load(std::memory_order_relaxed);
+            while (length < current &&
+                   !bound.compare_exchange_weak(current, length, std::memory_order_relaxed)) {
+            }
+        }
+
+        void dfs(size_t depth, uint32_t visited, double length, double remaining) {
+            ++nodes;
+            uint32_t last = path[depth - 1];
+            if (depth == n) {
+                if (path[1] < path[n - 1]) offer(length + at(last, 0));
+                return;
+            }
+            for (uint32_t c = 1; c < n; ++c) {
+                if (visited & (1u << c)) continue;
+                if (depth == n - 1 && c < path[1]) continue;
+                double extended = length + at(last, c);
+                if (prune(c, extended, remaining)) continue;
+                path[depth] = c;
+                dfs(depth + 1, visited | (1u << c), extended, remaining - minOut[c]);
+            }
+        }
+    };
+
+public:
+    explicit BruteForceTSP(size_t maxPoints = 12, unsigned threads = 0)
+        : m_maxPoints(maxPoints), m_threads(threads), m_nodesExplored(0) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        if (graph.size() > m_maxPoints || graph.size() > 32) {
+            throw TSPException("Brute force only for small graphs");
+        }
+
+        const size_t n = graph.size();
+        m_nodesExplored = 0;
+        if (n <= 3) {
+            std::vector<uint32_t> order(n);
+            for (size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+            m_nodesExplored = 1;
+            recordExecutionTime(start);
+            return Route(graph, std::move(order));
+        }
+
+        const DistanceMatrix& matrix = graph.getDistanceMatrix();
+        std::vector<double> dist(n * n);
+        for (size_t a = 0; a < n; ++a)
+            for (size_t b = 0; b < n; ++b) dist[a * n + b] = matrix.at(a, b);
+
+        std::vector<double> minOut(n, std::numeric_limits<double>::max());
+        double unvisited = 0.0;     // soma de minOut das cidades 1..n-1
+        for (size_t a = 0; a < n; ++a) {
+            for (size_t b = 0; b < n; ++b) {
+                if (a != b) minOut[a] = std::min(minOut[a], dist[a * n + b]);
+            }
+            if (a > 0) unvisited += minOut[a];
+        }
+        const bool triangle = graph.getDistanceConfig().metric == DistanceMetric::Euclidean;
+
+        // Limite inicial: a rota identidade 0, 1, ..., n-1
+        double identity = dist[(n - 1) * n];
+        for (size_t i = 0; i + 1 < n; ++i) identity += dist[i * n + i + 1];
+        std::atomic<double> bound(identity);
+
+        // Unidades de trabalho: todos os prefixos (após a cidade 0) de tamanho fixo
+        size_t depth = std::min(PREFIX_DEPTH, n - 2);
+        std::vector<std::vector<uint32_t>> units;
+        std::vector<uint32_t> prefix;
+        auto enumerate = [&](auto&& self, uint32_t used) -> void {
+            if (prefix.size() == depth) { units.push_back(prefix); return; }
+            for (uint32_t c = 1; c < n; ++c) {
+                if (used & (1u << c)) continue;
+                prefix.push_back(c);
+                self(self, used | (1u << c));
+                prefix.pop_back();
+            }
+        };
+        enumerate(enumerate, 1u);
+
+        unsigned threadCount = m_threads ? m_threads : std::thread::hardware_concurrency();
+        if (threadCount == 0) threadCount = 1;
+        threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, units.size()));
+
+        std::atomic<size_t> nextUnit(0);
+        std::vector<Search> searches;
+        searches.reserve(threadCount);
+        for (unsigned t = 0; t < threadCount; ++t) searches.emplace_back(dist, minOut, triangle, n, bound);
+
+        auto worker = [&](Search& search) {
+            for (size_t u = nextUnit.fetch_add(1); u < units.size(); u = nextUnit.fetch_add(1)) {
+                const auto& unit = units[u];
+                search.path[0] = 0;
+                uint32_t visited = 1u;
+                double length = 0.0;
+                double remaining = unvisited;
+                uint32_t last = 0;
+                bool pruned = false;
+                for (size_t i = 0; i < unit.size(); ++i) {
+                    length += search.at(last, unit[i]);
+                    if (search.prune(unit[i], length, remaining)) {
+                        pruned = true;
+                        break;
+                    }
+                    remaining -= minOut[unit[i]];
+                    last = unit[i];
+                    search.path[i + 1] = last;
+                    visited |= 1u << last;
+                }
+                if (!pruned) search.dfs(unit.size() + 1, visited, length, remaining);
+            }
+        };
+
+        if (threadCount == 1) {
+            worker(searches[0]);
+        } else {
+            std::vector<std::thread> pool;
+            for (unsigned t = 0; t < threadCount; ++t) pool.emplace_back(worker, std::ref(searches[t]));
+            for (auto& th : pool) th.join();
+        }
+
+        // Redução determinística: menor comprimento, depois menor sequência
+        const Search* winner = nullptr;
+        for (const auto& search : searches) {
+            m_nodesExplored += search.nodes;
+            if (search.best.empty()) continue;
+            if (!winner || search.bestLength < winner->bestLength ||
+                (search.bestLength == winner->bestLength && search.best < winner->best)) {
+                winner = &search;
+            }
+        }
+
+        std::vector<uint32_t> order;
+        if (winner) {
+            order = winner->best;
+        } else {
+            // Nenhuma rota superou o limite inicial: a identidade é ótima
+            order.resize(n);
+            for (size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+        }
+
+        recordExecutionTime(start);
+        return Route(graph, std::move(order));
+    }
+
+    /**
+     * @brief Nós da árvore de busca visitados na última execução
+     */
+    uint64_t getNodesExplored() const { return m_nodesExplored; }
+
+    std::string getName() const override { return "Brute Force"; }
+    std::string getDescription() const override {
+        return "Exhaustive branch-and-bound search over all permutations";
+    }
+};
+
+#endif // BRUTEFORCETSP_H
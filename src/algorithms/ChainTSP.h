@@ -0,0 +1,140 @@
+#ifndef CHAINTSP_H
+#define CHAINTSP_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <type_traits>
+#include <algorithm>
+
+#include "core/TSPAlgorithm.h"
+#include "core/TSPException.h"
+
+/**
+ * @brief Encadeia um construtivo e uma sequência de melhorias
+ *
+ * Ex.: Greedy Edge → 2-opt → Or-opt. Cada etapa de melhoria parte da rota
+ * da etapa anterior (TSPImprover::improve). Com limite de tempo, o
+ * orçamento é dividido em solve(): o construtivo recebe CONSTRUCTOR_SHARE
+ * dele como seu time_limit_ms (GA, SA e ACO param por tempo; os demais
+ * ignoram), ou o orçamento inteiro se não houver melhorias; cada melhoria
+ * recebe o que sobrou dividido pelas melhorias restantes (a última fica
+ * com todo o resto), então o tempo que uma etapa não usa passa para as
+ * seguintes. Uma melhoria sem tempo restante é pulada. Sem limite, cada
+ * etapa mantém o próprio. O comprimento e o tempo de cada etapa ficam em
+ * getStages().
+ *
+ * Parâmetros (setParameters): time_limit_ms; os demais (threads,
+ * neighbor_count...) são repassados a todas as etapas.
+ *
+ * Demonstra conceitos POO:
+ * - Composição: a cadeia contém e coordena outros algoritmos
+ * - Polimorfismo: qualquer TSPAlgorithm como construtivo, qualquer
+ *   TSPImprover como melhoria
+ */
+class ChainTSP : public TSPAlgorithm {
+public:
+    /// Resultado de uma etapa da última execução
+    struct StageResult {
+        std::string name;
+        double length = 0.0;
+        long milliseconds = 0;
+        bool skipped = false;      ///< Sem tempo restante
+    };
+
+private:
+    struct Stage {
+        std::unique_ptr<TSPAlgorithm> algorithm;
+        TSPImprover* improver;
+    };
+
+    /// Fração do orçamento dada ao construtivo quando há melhorias
+    static constexpr double CONSTRUCTOR_SHARE = 0.5;
+
+    std::unique_ptr<TSPAlgorithm> m_constructor;
+    std::vector<Stage> m_stages;
+    std::vector<StageResult> m_results;
+    long m_timeLimitMs = 0;
+
+public:
+    explicit ChainTSP(std::unique_ptr<TSPAlgorithm> constructor)
+        : m_constructor(std::move(constructor)) {
+        if (!m_constructor) throw TSPException("Chain needs a construction algorithm");
+    }
+
+    /**
+     * @brief Acrescenta uma etapa de melhoria ao fim da cadeia
+     */
+    template <typename Improver>
+    void addStage(std::unique_ptr<Improver> stage) {
+        static_assert(std::is_base_of_v<TSPAlgorithm, Improver> && std::is_base_of_v<TSPImprover, Improver>,
+                      "Chain stages must be TSPAlgorithm and TSPImprover");
+        TSPImprover* improver = stage.get();
+        m_stages.push_back({std::move(stage), improver});
+    }
+
+    Route solve(const Graph& graph) override {
+        auto begin = Clock::now();
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        m_results.clear();
+
+        if (m_timeLimitMs > 0) {
+            long share = m_stages.empty() ? m_timeLimitMs
+                                          : std::max(1L, static_cast<long>(m_timeLimitMs * CONSTRUCTOR_SHARE));
+            m_constructor->setParameters({{"time_limit_ms", static_cast<double>(share)}});
+        }
+        Route route = m_constructor->solve(graph);
+        m_results.push_back({m_constructor->getName(), route.getTotalDistance(),
+                             m_constructor->getLastExecutionTime(), false});
+
+        for (size_t s = 0; s < m_stages.size(); ++s) {
+            Stage& stage = m_stages[s];
+            StageResult result{stage.algorithm->getName(), route.getTotalDistance(), 0, false};
+            if (m_timeLimitMs > 0) {
+                long remaining = m_timeLimitMs - static_cast<long>(
+                    std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - begin).count());
+                if (remaining <= 0) {
+                    result.skipped = true;
+                    m_results.push_back(result);
+                    continue;
+                }
+                long stagesLeft = static_cast<long>(m_stages.size() - s);
+                stage.improver->setTimeLimit(std::max(1L, remaining / stagesLeft));
+            }
+            route = stage.improver->improve(route);
+            result.length = route.getTotalDistance();
+            result.milliseconds = stage.algorithm->getLastExecutionTime();
+            m_results.push_back(result);
+        }
+
+        recordExecutionTime(begin);
+        return route;
+    }
+
+    /// Orçamento da cadeia inteira em ms (0 = sem limite)
+    void setTimeLimit(long milliseconds) { setParameters({{"time_limit_ms", static_cast<double>(milliseconds)}}); }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        auto limit = params.find("time_limit_ms");
+        if (limit != params.end()) m_timeLimitMs = static_cast<long>(limit->second);
+        // O limite vale para a cadeia: a divisão entre as etapas é feita em solve()
+        std::unordered_map<std::string, double> forwarded = params;
+        forwarded.erase("time_limit_ms");
+        m_constructor->setParameters(forwarded);
+        for (Stage& stage : m_stages) stage.algorithm->setParameters(forwarded);
+    }
+
+    const std::vector<StageResult>& getStages() const { return m_results; }
+
+    std::string getName() const override {
+        std::string name = m_constructor->getName();
+        for (const Stage& stage : m_stages) name += " + " + stage.algorithm->getName();
+        return name;
+    }
+
+    std::string getDescription() const override {
+        return "Construction followed by a sequence of local improvements under a shared time budget";
+    }
+};
+
+#endif // CHAINTSP_H
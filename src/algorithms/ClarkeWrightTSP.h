@@ -0,0 +1,200 @@
+#ifndef CLARKEWRIGHTTSP_H
+#define CLARKEWRIGHTTSP_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+#include <unordered_map>
+
+#include "core/TSPAlgorithm.h"
+#include "core/CandidateLists.h"
+#include "core/KDTree.h"
+#include "core/RadixSort.h"
+#include "core/ThreadPool.h"
+
+/**
+ * @brief Heurística das economias de Clarke-Wright (depósito = cidade 0)
+ *
+ * Parte de uma rota depósito-i-depósito para cada cidade e junta rotas
+ * pelas pontas em ordem decrescente de economia
+ * s(i, j) = d(0, i) + d(0, j) - d(i, j). Só os pares de vizinhos mais
+ * próximos (listas de candidatos) são considerados: as economias são
+ * calculadas em paralelo e ordenadas pelo radix sort paralelo.
+ *
+ * Cada caminho é representado apenas pelas suas pontas: otherEnd[p] dá a
+ * outra ponta do caminho que termina em p, então testar e fazer a junção
+ * de i com j é O(1). Caminhos que sobram (pares fora das listas) são
+ * encadeados a partir do depósito, sempre para a ponta livre mais próxima
+ * (KDTree, ou varredura da matriz quando a métrica não segue as
+ * coordenadas).
+ *
+ * Parâmetros (setParameters): neighbor_count, threads.
+ */
+class ClarkeWrightTSP : public TSPAlgorithm {
+private:
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t DEPOT = 0;
+
+    size_t m_neighborCount;
+    unsigned m_threads;
+
+    struct Pair {
+        uint32_t a;
+        uint32_t b;
+    };
+
+public:
+    /**
+     * @param neighborCount Vizinhos por cidade que geram pares candidatos
+     * @param threads Threads para economias e ordenação (0 = hardware_concurrency())
+     */
+    explicit ClarkeWrightTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : m_neighborCount(neighborCount), m_threads(threads) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        const size_t n = graph.size();
+        if (n <= 3) {
+            std::vector<uint32_t> order(n);
+            for (size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+            recordExecutionTime(start);
+            return Route(graph, std::move(order));
+        }
+
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        CandidateLists candidates(graph, m_neighborCount, m_threads);
+        const size_t k = candidates.k();
+
+        // Pares candidatos sem repetição e sem o depósito
+        std::vector<Pair> pairs;
+        pairs.reserve(n * k);
+        for (uint32_t i = 1; i < n; ++i) {
+            const uint32_t* neighbors = candidates.of(i);
+            for (size_t t = 0; t < k; ++t) {
+                uint32_t j = neighbors[t];
+                if (j == DEPOT) continue;
+                if (j < i) {
+                    const uint32_t* back = candidates.of(j);
+                    if (std::find(back, back + k, i) != back + k) continue;
+                }
+                pairs.push_back({i, j});
+            }
+        }
+
+        // Economias em paralelo; a chave é o complemento dos bits do float
+        // (não negativo), então a ordem crescente do radix sort é a ordem
+        // decrescente de economia
+        ThreadPool pool(m_threads);
+        RadixSort::Items items(pairs.size());
+        pool.parallelFor(pairs.size(), [&](size_t p, unsigned) {
+            uint32_t a = pairs[p].a, b = pairs[p].b;
+            float saving = std::max(0.0f, static_cast<float>(
+                dist.at(DEPOT, a) + dist.at(DEPOT, b) - dist.at(a, b)));
+            uint32_t bits;
+            std::memcpy(&bits, &saving, sizeof(bits));
+            items[p] = RadixSort::pack(~bits, static_cast<uint32_t>(p));
+        });
+        RadixSort::sortByKey(items, pool);
+
+        // Cidade isolada: as duas pontas do caminho são ela mesma
+        std::vector<uint32_t> adjacency(2 * n, NONE);
+        std::vector<uint32_t> otherEnd(n);
+        for (uint32_t i = 0; i < n; ++i) otherEnd[i] = i;
+        auto degree = [&](uint32_t c) {
+            return (adjacency[2 * size_t(c)] != NONE) + (adjacency[2 * size_t(c) + 1] != NONE);
+        };
+        auto link = [&](uint32_t a, uint32_t b) {
+            adjacency[2 * size_t(a) + (adjacency[2 * size_t(a)] != NONE)] = b;
+            adjacency[2 * size_t(b) + (adjacency[2 * size_t(b)] != NONE)] = a;
+        };
+
+        size_t merges = 0;
+        for (uint64_t item : items) {
+            const Pair& pair = pairs[RadixSort::valueOf(item)];
+            uint32_t a = pair.a, b = pair.b;
+            if (degree(a) == 2 || degree(b) == 2 || otherEnd[a] == b) continue;
+            uint32_t endA = otherEnd[a], endB = otherEnd[b];
+            link(a, b);
+            otherEnd[endA] = endB;
+            otherEnd[endB] = endA;
+            if (++merges == n - 2) break;     // um único caminho sem o depósito
+        }
+
+        // Encadeia os caminhos restantes a partir do depósito
+        uint32_t current = DEPOT;
+        if (followsCoordinates(graph.getDistanceConfig().metric)) {
+            KDTree endpoints(graph);
+            endpoints.remove(DEPOT);
+            for (uint32_t c = 1; c < n; ++c) {
+                if (degree(c) == 2) endpoints.remove(c);
+            }
+            while (!endpoints.empty()) {
+                uint32_t end = endpoints.nearest(graph.getX(current), graph.getY(current));
+                endpoints.remove(end);
+                endpoints.remove(otherEnd[end]);
+                link(current, end);
+                current = otherEnd[end];
+            }
+        } else {
+            // GEO e matriz explícita: varredura das pontas livres na matriz
+            std::vector<uint32_t> endpoints, slot(n, NONE);
+            for (uint32_t c = 1; c < n; ++c) {
+                if (degree(c) == 2) continue;
+                slot[c] = static_cast<uint32_t>(endpoints.size());
+                endpoints.push_back(c);
+            }
+            auto remove = [&](uint32_t c) {
+                if (slot[c] == NONE) return;
+                uint32_t last = endpoints.back();
+                endpoints[slot[c]] = last;
+                slot[last] = slot[c];
+                endpoints.pop_back();
+                slot[c] = NONE;
+            };
+            while (!endpoints.empty()) {
+                uint32_t end = endpoints[0];
+                for (uint32_t c : endpoints) {
+                    if (dist.at(current, c) < dist.at(current, end)) end = c;
+                }
+                remove(end);
+                remove(otherEnd[end]);
+                link(current, end);
+                current = otherEnd[end];
+            }
+        }
+        link(current, DEPOT);
+
+        Route route(graph);
+        route.reserve(n);
+        uint32_t previous = NONE, city = DEPOT;
+        for (size_t step = 0; step < n; ++step) {
+            route.addPoint(city);
+            uint32_t next = adjacency[2 * size_t(city)];
+            if (next == previous) next = adjacency[2 * size_t(city) + 1];
+            previous = city;
+            city = next;
+        }
+
+        recordExecutionTime(start);
+        return route;
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "neighbor_count") m_neighborCount = static_cast<size_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+        }
+    }
+
+    std::string getName() const override { return "Clarke-Wright Savings"; }
+    std::string getDescription() const override {
+        return "Merges depot round trips by decreasing savings over nearest-neighbor pairs";
+    }
+};
+
+#endif // CLARKEWRIGHTTSP_H
@@ -0,0 +1,467 @@
+#ifndef GENETICTSP_H
+#define GENETICTSP_H
+
+#include <vector>
+#include <string>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+#include <thread>
+#include <atomic>
+#include <memory>
+
+#include "core/TSPAlgorithm.h"
+#include "core/ThreadPool.h"
+#include "core/FastRandom.h"
+#include "core/SpscQueue.h"
+#include "algorithms/NearestNeighborTSP.h"
+
+/**
+ * @brief Algoritmo genético para TSP sobre permutações de índices
+ *
+ * Cada indivíduo é uma permutação de índices de cidades guardada em uma
+ * arena contígua (população x n); a população atual e a próxima usam duas
+ * arenas alocadas uma única vez, trocadas a cada geração, então nenhuma
+ * geração aloca memória. Os filhos são gerados e avaliados em paralelo em
+ * um ThreadPool; cada filho usa um gerador derivado de (semente, geração,
+ * índice), de modo que o resultado não depende do número de threads.
+ *
+ * Operadores: seleção por torneio, crossover OX (order crossover),
+ * mutação por inversão de segmento e elitismo.
+ *
+ * Modelo de ilhas (islands > 1): cada ilha evolui sua própria
+ * subpopulação de population_size indivíduos, com fluxo de números
+ * aleatórios independente. As ilhas rodam num ThreadPool de
+ * min(islands, threads) participantes; cada participante avança as suas
+ * ilhas (uma a cada tantos participantes) uma geração por vez. A cada
+ * migration_interval gerações cada ilha envia cópias dos seus migrants
+ * melhores à seguinte no anel, por filas sem lock, e substitui seus
+ * piores pelos recebidos da anterior; um participante envia os pacotes de
+ * todas as suas ilhas antes de esperar pelos que recebe. Como cada ilha
+ * espera os migrantes da mesma geração, o resultado é determinístico para
+ * uma dada semente e número de ilhas, qualquer que seja o número de
+ * threads (exceto quando o limite de tempo interrompe a evolução).
+ *
+ * Parâmetros (setParameters): population_size, max_generations,
+ * mutation_rate, crossover_rate, elite_count, tournament_size, seed,
+ * threads, time_limit_ms, islands, migration_interval, migrants.
+ */
+class GeneticTSP : public TSPAlgorithm {
+private:
+    int m_populationSize;
+    int m_maxGenerations;
+    double m_mutationRate;
+    double m_crossoverRate;
+    int m_eliteCount;
+    int m_tournamentSize;
+    uint64_t m_seed;
+    unsigned m_threads;
+    long m_timeLimitMs;
+    int m_islands;
+    int m_migrationInterval;
+    int m_migrants;
+
+    size_t m_generations;
+    double m_generationsPerSecond;
+
+    /// Arena de indivíduos: genes contíguos e comprimento de cada rota
+    struct Population {
+        size_t cities = 0;
+        std::vector<uint32_t> genes;
+        std::vector<double> length;
+
+        void allocate(size_t size, size_t n) {
+            cities = n;
+            genes.assign(size * n, 0);
+            length.assign(size, 0.0);
+        }
+        uint32_t* individual(size_t i) { return genes.data() + i * cities; }
+        const uint32_t* individual(size_t i) const { return genes.data() + i * cities; }
+    };
+
+    /// Marcação de cidades usadas no crossover, uma por participante do pool
+    struct Scratch {
+        std::vector<uint32_t> stamp;
+        uint32_t token = 0;
+    };
+
+    /// Pacote de migrantes trocado entre ilhas vizinhas
+    struct Migrants {
+        std::vector<uint32_t> genes;
+        std::vector<double> length;
+    };
+
+    static double evaluate(const DistanceMatrix& dist, const uint32_t* tour, size_t n) {
+        double total = dist.at(tour[n - 1], tour[0]);
+        for (size_t i = 0; i + 1 < n; ++i) total += dist.at(tour[i], tour[i + 1]);
+        return total;
+    }
+
+    /**
+     * @brief Cria população inicial: rota do vizinho mais próximo + permutações aleatórias
+     */
+    void createInitialPopulation(const Graph& graph, const std::vector<uint32_t>& seedTour,
+                                 Population& population, ThreadPool& pool, uint64_t stream) const {
+        const size_t n = graph.size();
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+
+        pool.parallelFor(population.length.size(), [&](size_t i, unsigned) {
+            uint32_t* genes = population.individual(i);
+            if (i == 0) {
+                std::copy(seedTour.begin(), seedTour.end(), genes);
+            } else {
+                FastRandom rng(FastRandom::mix(stream, 0, i));
+                for (size_t c = 0; c < n; ++c) genes[c] = static_cast<uint32_t>(c);
+                for (size_t c = n - 1; c > 0; --c) {
+                    std::swap(genes[c], genes[rng.uniform(static_cast<uint32_t>(c + 1))]);
+                }
+            }
+            population.length[i] = evaluate(dist, genes, n);
+        });
+    }
+
+    /**
+     * @brief Order crossover (OX): copia um trecho de parent1 e completa na ordem de parent2
+     */
+    static void crossover(const uint32_t* parent1, const uint32_t* parent2, uint32_t* child,
+                          size_t n, FastRandom& rng, Scratch& scratch) {
+        if (++scratch.token == 0) {
+            std::fill(scratch.stamp.begin(), scratch.stamp.end(), 0);
+            scratch.token = 1;
+        }
+        size_t a = rng.uniform(static_cast<uint32_t>(n));
+        size_t b = rng.uniform(static_cast<uint32_t>(n));
+        if (a > b) std::swap(a, b);
+
+        for (size_t i = a; i <= b; ++i) {
+            child[i] = parent1[i];
+            scratch.stamp[parent1[i]] = scratch.token;
+        }
+        size_t write = (b + 1) % n;
+        for (size_t k = 0; k < n; ++k) {
+            uint32_t city = parent2[(b + 1 + k) % n];
+            if (scratch.stamp[city] == scratch.token) continue;
+            child[write] = city;
+            write = (write + 1) % n;
+        }
+    }
+
+    /**
+     * @brief Mutação por inversão de um segmento aleatório
+     */
+    void mutate(uint32_t* genes, size_t n, FastRandom& rng) const {
+        if (rng.uniformReal() >= m_mutationRate) return;
+        size_t a = rng.uniform(static_cast<uint32_t>(n));
+        size_t b = rng.uniform(static_cast<uint32_t>(n));
+        if (a > b) std::swap(a, b);
+        std::reverse(genes + a, genes + b + 1);
+    }
+
+    size_t tournament(const Population& population, FastRandom& rng) const {
+        const uint32_t size = static_cast<uint32_t>(population.length.size());
+        size_t best = rng.uniform(size);
+        for (int t = 1; t < m_tournamentSize; ++t) {
+            size_t rival = rng.uniform(size);
+            if (population.length[rival] < population.length[best]) best = rival;
+        }
+        return best;
+    }
+
+    static bool better(const Population& population, uint32_t a, uint32_t b) {
+        return population.length[a] < population.length[b] ||
+               (population.length[a] == population.length[b] && a < b);
+    }
+
+    /**
+     * @brief Gera a próxima população (elitismo + filhos)
+     * @param stream Semente do fluxo aleatório (da execução ou da ilha)
+     * @param loop Executor do laço de filhos: loop(count, body(k, participante))
+     */
+    template <typename Loop>
+    void breed(const DistanceMatrix& dist, Population& current, Population& next,
+               std::vector<uint32_t>& ranking, std::vector<Scratch>& scratch,
+               uint64_t stream, int generation, Loop&& loop) const {
+        const size_t size = current.length.size();
+        const size_t n = current.cities;
+        const size_t elites = static_cast<size_t>(m_eliteCount);
+
+        // Elitismo: os melhores passam direto para a próxima geração
+        for (size_t i = 0; i < size; ++i) ranking[i] = static_cast<uint32_t>(i);
+        std::partial_sort(ranking.begin(), ranking.begin() + elites, ranking.end(),
+            [&](uint32_t a, uint32_t b) { return better(current, a, b); });
+        for (size_t e = 0; e < elites; ++e) {
+            std::copy(current.individual(ranking[e]), current.individual(ranking[e]) + n,
+                      next.individual(e));
+            next.length[e] = current.length[ranking[e]];
+        }
+
+        loop(size - elites, [&](size_t k, unsigned participant) {
+            size_t i = elites + k;
+            FastRandom rng(FastRandom::mix(stream, static_cast<uint64_t>(generation), i));
+            const uint32_t* parent1 = current.individual(tournament(current, rng));
+            const uint32_t* parent2 = current.individual(tournament(current, rng));
+            uint32_t* child = next.individual(i);
+            if (rng.uniformReal() < m_crossoverRate) {
+                crossover(parent1, parent2, child, n, rng, scratch[participant]);
+            } else {
+                std::copy(parent1, parent1 + n, child);
+            }
+            mutate(child, n, rng);
+            next.length[i] = evaluate(dist, child, n);
+        });
+    }
+
+    /**
+     * @brief População única, filhos gerados em paralelo no ThreadPool
+     */
+    std::vector<uint32_t> evolvePanmictic(const Graph& graph, Clock::time_point deadline) {
+        const size_t n = graph.size();
+        const size_t size = static_cast<size_t>(m_populationSize);
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+
+        ThreadPool pool(m_threads);
+        Population current, next;
+        current.allocate(size, n);
+        next.allocate(size, n);
+        std::vector<Scratch> scratch(pool.size());
+        for (auto& s : scratch) s.stamp.assign(n, 0);
+        std::vector<uint32_t> ranking(size);
+
+        std::vector<uint32_t> seedTour = NearestNeighborTSP().solve(graph).getSequence();
+        createInitialPopulation(graph, seedTour, current, pool, m_seed);
+
+        auto evolveStart = Clock::now();
+        auto loop = [&](size_t count, auto&& body) { pool.parallelFor(count, body); };
+        for (int generation = 1; generation <= m_maxGenerations; ++generation) {
+            if (m_timeLimitMs > 0 && Clock::now() > deadline) break;
+            breed(dist, current, next, ranking, scratch, m_seed, generation, loop);
+            std::swap(current, next);
+            ++m_generations;
+        }
+
+        double seconds = std::chrono::duration<double>(Clock::now() - evolveStart).count();
+        if (seconds > 0.0) m_generationsPerSecond = m_generations / seconds;
+
+        uint32_t best = 0;
+        for (uint32_t i = 1; i < size; ++i) {
+            if (better(current, i, best)) best = i;
+        }
+        return std::vector<uint32_t>(current.individual(best), current.individual(best) + n);
+    }
+
+    /**
+     * @brief Modelo de ilhas: subpopulações num pool limitado por threads, migração em anel
+     */
+    std::vector<uint32_t> evolveIslands(const Graph& graph, Clock::time_point deadline) {
+        const size_t n = graph.size();
+        const size_t size = static_cast<size_t>(m_populationSize);
+        const size_t islands = static_cast<size_t>(m_islands);
+        const size_t migrants = static_cast<size_t>(m_migrants);
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+
+        struct Island {
+            Population current, next;
+            std::vector<Scratch> scratch;
+            std::vector<uint32_t> ranking;
+            uint64_t stream = 0;
+            size_t generations = 0;
+        };
+        std::vector<Island> state(islands);
+        // channels[i]: da ilha i para a ilha (i + 1) % islands
+        std::vector<std::unique_ptr<SpscQueue<Migrants>>> channels(islands);
+        for (size_t i = 0; i < islands; ++i) {
+            channels[i] = std::make_unique<SpscQueue<Migrants>>(4);
+            for (auto& slot : channels[i]->slots()) {
+                slot.genes.assign(migrants * n, 0);
+                slot.length.assign(migrants, 0.0);
+            }
+        }
+
+        // Cada ilha tem uma tarefa longa e que espera as vizinhas: um participante por tarefa
+        const unsigned limit = m_threads ? m_threads : std::thread::hardware_concurrency();
+        ThreadPool pool(static_cast<unsigned>(std::min<size_t>(islands, std::max(1u, limit))));
+        const size_t workers = pool.size();
+
+        // A rota do vizinho mais próximo é a mesma para todas as ilhas
+        std::vector<uint32_t> seedTour = NearestNeighborTSP().solve(graph).getSequence();
+        ThreadPool sequential(1);
+        pool.parallelFor(islands, [&](size_t i, unsigned) {
+            Island& island = state[i];
+            island.current.allocate(size, n);
+            island.next.allocate(size, n);
+            island.scratch.resize(1);
+            island.scratch[0].stamp.assign(n, 0);
+            island.ranking.resize(size);
+            island.stream = FastRandom::mix(m_seed, 0x15A4D, i);
+            createInitialPopulation(graph, seedTour, island.current, sequential, island.stream);
+        }, 1);
+
+        std::atomic<bool> stop(false);
+        auto evolveStart = Clock::now();
+
+        auto run = [&](size_t worker, unsigned) {
+            auto loop = [](size_t count, auto&& body) {
+                for (size_t k = 0; k < count; ++k) body(k, 0u);
+            };
+
+            for (int generation = 1; generation <= m_maxGenerations; ++generation) {
+                if (stop.load(std::memory_order_relaxed)) return;
+                if (m_timeLimitMs > 0 && Clock::now() > deadline) {
+                    stop.store(true);
+                    return;
+                }
+                const bool migrate = generation % m_migrationInterval == 0;
+                for (size_t index = worker; index < islands; index += workers) {
+                    Island& island = state[index];
+                    breed(dist, island.current, island.next, island.ranking, island.scratch,
+                          island.stream, generation, loop);
+                    std::swap(island.current, island.next);
+                    ++island.generations;
+                    if (!migrate) continue;
+
+                    Population& pop = island.current;
+                    auto& ranking = island.ranking;
+                    for (size_t r = 0; r < size; ++r) ranking[r] = static_cast<uint32_t>(r);
+                    std::sort(ranking.begin(), ranking.end(),
+                              [&](uint32_t a, uint32_t b) { return better(pop, a, b); });
+
+                    // Envia cópias dos melhores para a próxima ilha
+                    auto fill = [&](Migrants& packet) {
+                        for (size_t m = 0; m < migrants; ++m) {
+                            std::copy(pop.individual(ranking[m]), pop.individual(ranking[m]) + n,
+                                      packet.genes.data() + m * n);
+                            packet.length[m] = pop.length[ranking[m]];
+                        }
+                    };
+                    SpscQueue<Migrants>& outbox = *channels[index];
+                    while (!outbox.tryPush(fill)) {
+                        if (stop.load(std::memory_order_relaxed)) return;
+                        std::this_thread::yield();
+                    }
+                }
+                if (!migrate) continue;
+
+                // Recebe os migrantes da mesma geração e substitui os piores
+                for (size_t index = worker; index < islands; index += workers) {
+                    Population& pop = state[index].current;
+                    const auto& ranking = state[index].ranking;
+                    auto consume = [&](Migrants& packet) {
+                        for (size_t m = 0; m < migrants; ++m) {
+                            uint32_t worst = ranking[size - 1 - m];
+                            std::copy(packet.genes.data() + m * n, packet.genes.data() + (m + 1) * n,
+                                      pop.individual(worst));
+                            pop.length[worst] = packet.length[m];
+                        }
+                    };
+                    SpscQueue<Migrants>& inbox = *channels[(index + islands - 1) % islands];
+                    while (!inbox.tryPop(consume)) {
+                        if (stop.load(std::memory_order_relaxed)) return;
+                        std::this_thread::yield();
+                    }
+                }
+            }
+        };
+        pool.parallelFor(workers, run, 1);
+
+        size_t total = 0;
+        for (const auto& island : state) {
+            total += island.generations;
+            m_generations = std::max(m_generations, island.generations);
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - evolveStart).count();
+        if (seconds > 0.0) m_generationsPerSecond = total / seconds;
+
+        // Melhor indivíduo entre as ilhas (empates: menor ilha, menor índice)
+        const Island* bestIsland = &state[0];
+        uint32_t best = 0;
+        for (const auto& island : state) {
+            for (uint32_t i = 0; i < size; ++i) {
+                if (island.current.length[i] < bestIsland->current.length[best]) {
+                    bestIsland = &island;
+                    best = i;
+                }
+            }
+        }
+        const Population& winner = bestIsland->current;
+        return std::vector<uint32_t>(winner.individual(best), winner.individual(best) + n);
+    }
+
+    void validate() const {
+        if (m_populationSize < 2) throw TSPException("Invalid parameter: population_size");
+        if (m_maxGenerations < 0) throw TSPException("Invalid parameter: max_generations");
+        if (m_eliteCount < 0 || m_eliteCount >= m_populationSize) {
+            throw TSPException("Invalid parameter: elite_count");
+        }
+        if (m_tournamentSize < 1) throw TSPException("Invalid parameter: tournament_size");
+        if (m_islands > 1) {
+            if (m_migrationInterval < 1) throw TSPException("Invalid parameter: migration_interval");
+            if (m_migrants < 1 || m_migrants > m_populationSize - m_eliteCount) {
+                throw TSPException("Invalid parameter: migrants");
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Construtor com parâmetros padrão
+     */
+    explicit GeneticTSP(int populationSize = 100, int maxGenerations = 500)
+        : m_populationSize(populationSize), m_maxGenerations(maxGenerations),
+          m_mutationRate(0.3), m_crossoverRate(0.9), m_eliteCount(2), m_tournamentSize(3),
+          m_seed(12345), m_threads(0), m_timeLimitMs(0),
+          m_islands(1), m_migrationInterval(20), m_migrants(2),
+          m_generations(0), m_generationsPerSecond(0.0) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        validate();
+
+        const size_t n = graph.size();
+        m_generations = 0;
+        m_generationsPerSecond = 0.0;
+        if (n <= 3) {
+            std::vector<uint32_t> order(n);
+            for (size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+            recordExecutionTime(start);
+            return Route(graph, std::move(order));
+        }
+
+        auto deadline = start + std::chrono::milliseconds(m_timeLimitMs);
+        std::vector<uint32_t> order = m_islands > 1 ? evolveIslands(graph, deadline)
+                                                    : evolvePanmictic(graph, deadline);
+
+        recordExecutionTime(start);
+        return Route(graph, std::move(order));
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "population_size") m_populationSize = static_cast<int>(value);
+            else if (key == "max_generations") m_maxGenerations = static_cast<int>(value);
+            else if (key == "mutation_rate") m_mutationRate = value;
+            else if (key == "crossover_rate") m_crossoverRate = value;
+            else if (key == "elite_count") m_eliteCount = static_cast<int>(value);
+            else if (key == "tournament_size") m_tournamentSize = static_cast<int>(value);
+            else if (key == "seed") m_seed = static_cast<uint64_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+            else if (key == "time_limit_ms") m_timeLimitMs = static_cast<long>(value);
+            else if (key == "islands") m_islands = static_cast<int>(value);
+            else if (key == "migration_interval") m_migrationInterval = static_cast<int>(value);
+            else if (key == "migrants") m_migrants = static_cast<int>(value);
+        }
+    }
+
+    /// Gerações concluídas na última execução (por ilha, no modelo de ilhas)
+    size_t getGenerations() const { return m_generations; }
+    /// Vazão da última execução (gerações por segundo, somando as ilhas)
+    double getGenerationsPerSecond() const { return m_generationsPerSecond; }
+
+    std::string getName() const override { return "Genetic Algorithm"; }
+    std::string getDescription() const override {
+        return "Evolutionary search with order crossover over index permutations";
+    }
+};
+
+#endif // GENETICTSP_H
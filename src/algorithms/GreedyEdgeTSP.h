@@ -0,0 +1,245 @@
+#ifndef GREEDYEDGETSP_H
+#define GREEDYEDGETSP_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+#include "core/TSPAlgorithm.h"
+#include "core/CandidateLists.h"
+#include "core/DisjointSets.h"
+#include "core/KDTree.h"
+#include "core/RadixSort.h"
+#include "core/ThreadPool.h"
+
+/**
+ * @brief Construção gulosa por arestas (greedy matching)
+ *
+ * As arestas candidatas são as dos k vizinhos mais próximos de cada
+ * cidade, processadas em ordem crescente de comprimento. Uma aresta é
+ * aceita se nenhuma das pontas já tem grau 2 e se não fecha um ciclo
+ * (union-find, ver DisjointSets). O resultado é um conjunto de caminhos
+ * disjuntos; os fragmentos são então ligados de ponta a ponta, sempre
+ * para a ponta livre mais próxima (KDTree com remoção, ou varredura da
+ * matriz quando a métrica não segue as coordenadas).
+ *
+ * Ao contrário do Nearest Neighbor, as arestas longas ficam apenas para
+ * a ligação final dos fragmentos, então a rota fica tipicamente 14-20%
+ * acima do ótimo, contra cerca de 25% do NN, com custo O(n k log(n k)).
+ *
+ * Parâmetros (setParameters): neighbor_count, threads.
+ */
+class GreedyEdgeTSP : public TSPAlgorithm {
+private:
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    size_t m_neighborCount;
+    unsigned m_threads;
+
+    struct Edge {
+        uint32_t a;
+        uint32_t b;
+    };
+
+    /// Adjacência com até duas ligações por cidade
+    static void link(std::vector<uint32_t>& adjacency, uint32_t a, uint32_t b) {
+        adjacency[2 * size_t(a) + (adjacency[2 * size_t(a)] != NONE)] = b;
+        adjacency[2 * size_t(b) + (adjacency[2 * size_t(b)] != NONE)] = a;
+    }
+
+    static int degree(const std::vector<uint32_t>& adjacency, uint32_t city) {
+        return (adjacency[2 * size_t(city)] != NONE) + (adjacency[2 * size_t(city) + 1] != NONE);
+    }
+
+public:
+    /**
+     * @param neighborCount Vizinhos por cidade que geram arestas candidatas
+     * @param threads Threads para a ordenação (0 = hardware_concurrency())
+     */
+    explicit GreedyEdgeTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : m_neighborCount(neighborCount), m_threads(threads) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        const size_t n = graph.size();
+        if (n <= 3) {
+            std::vector<uint32_t> order(n);
+            for (size_t i = 0; i < n; ++i) order[i] = static_cast<uint32_t>(i);
+            recordExecutionTime(start);
+            return Route(graph, std::move(order));
+        }
+
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        CandidateLists candidates(graph, m_neighborCount, m_threads);
+        const size_t k = candidates.k();
+
+        // Arestas candidatas sem repetição: (i, j) entra pela lista de i se
+        // i < j ou se i não aparece na lista de j
+        std::vector<Edge> edges;
+        edges.reserve(n * k);
+        for (uint32_t i = 0; i < n; ++i) {
+            const uint32_t* neighbors = candidates.of(i);
+            for (size_t t = 0; t < k; ++t) {
+                uint32_t j = neighbors[t];
+                if (j < i) {
+                    const uint32_t* back = candidates.of(j);
+                    if (std::find(back, back + k, i) != back + k) continue;
+                }
+                edges.push_back({i, j});
+            }
+        }
+
+        // Comprimentos positivos em float têm a mesma ordem dos seus bits,
+        // então servem direto de chave para o radix sort
+        ThreadPool pool(m_threads);
+        RadixSort::Items items(edges.size());
+        pool.parallelFor(edges.size(), [&](size_t e, unsigned) {
+            float length = static_cast<float>(dist.at(edges[e].a, edges[e].b));
+            uint32_t bits;
+            std::memcpy(&bits, &length, sizeof(bits));
+            items[e] = RadixSort::pack(bits, static_cast<uint32_t>(e));
+        });
+        RadixSort::sortByKey(items, pool);
+
+        std::vector<uint32_t> adjacency(2 * n, NONE);
+        DisjointSets sets(n);
+        size_t accepted = 0;
+        for (uint64_t item : items) {
+            const Edge& edge = edges[RadixSort::valueOf(item)];
+            if (degree(adjacency, edge.a) == 2 || degree(adjacency, edge.b) == 2) continue;
+            if (!sets.unite(edge.a, edge.b)) continue;
+            link(adjacency, edge.a, edge.b);
+            if (++accepted == n - 1) break;
+        }
+
+        joinFragments(graph, adjacency);
+
+        // Percorre o ciclo a partir da cidade 0
+        Route route(graph);
+        route.reserve(n);
+        uint32_t previous = NONE, current = 0;
+        for (size_t step = 0; step < n; ++step) {
+            route.addPoint(current);
+            uint32_t next = adjacency[2 * size_t(current)];
+            if (next == previous) next = adjacency[2 * size_t(current) + 1];
+            previous = current;
+            current = next;
+        }
+
+        recordExecutionTime(start);
+        return route;
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "neighbor_count") m_neighborCount = static_cast<size_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+        }
+    }
+
+    std::string getName() const override { return "Greedy Edge"; }
+    std::string getDescription() const override {
+        return "Shortest candidate edges first, rejecting degree-3 nodes and subcycles";
+    }
+
+private:
+    /**
+     * @brief Liga os caminhos do conjunto guloso em um único ciclo
+     *
+     * Partindo de um fragmento, vai da sua ponta final até a ponta livre
+     * mais próxima de outro fragmento, percorre-o e repete. Cidades isoladas
+     * são fragmentos cujas duas pontas são a própria cidade.
+     */
+    static void joinFragments(const Graph& graph, std::vector<uint32_t>& adjacency) {
+        const uint32_t n = static_cast<uint32_t>(graph.size());
+
+        // Outra ponta de cada fragmento
+        std::vector<uint32_t> otherEnd(n, NONE);
+        for (uint32_t city = 0; city < n; ++city) {
+            if (degree(adjacency, city) == 2 || otherEnd[city] != NONE) continue;
+            uint32_t previous = NONE, current = city;
+            for (;;) {
+                uint32_t next = adjacency[2 * size_t(current)];
+                if (next == previous) next = adjacency[2 * size_t(current) + 1];
+                if (next == NONE) break;
+                previous = current;
+                current = next;
+            }
+            otherEnd[city] = current;
+            otherEnd[current] = city;
+        }
+
+        uint32_t first = NONE;
+        for (uint32_t city = 0; city < n && first == NONE; ++city) {
+            if (otherEnd[city] != NONE) first = city;
+        }
+        if (first == NONE) return;
+        if (!followsCoordinates(graph.getDistanceConfig().metric)) {
+            joinByMatrix(graph, adjacency, otherEnd, first);
+            return;
+        }
+
+        KDTree endpoints(graph);
+        for (uint32_t city = 0; city < n; ++city) {
+            if (otherEnd[city] == NONE) endpoints.remove(city);
+        }
+        endpoints.remove(first);
+        endpoints.remove(otherEnd[first]);
+        uint32_t current = otherEnd[first];
+        while (!endpoints.empty()) {
+            uint32_t next = endpoints.nearest(graph.getX(current), graph.getY(current));
+            endpoints.remove(next);
+            endpoints.remove(otherEnd[next]);
+            link(adjacency, current, next);
+            current = otherEnd[next];
+        }
+        link(adjacency, current, first);
+    }
+
+    /**
+     * @brief joinFragments para GEO e matriz explícita, cujas distâncias não
+     *        seguem as coordenadas: a ponta livre mais próxima é achada
+     *        varrendo a matriz (O(f²) nos f fragmentos)
+     */
+    static void joinByMatrix(const Graph& graph, std::vector<uint32_t>& adjacency,
+                             const std::vector<uint32_t>& otherEnd, uint32_t first) {
+        const uint32_t n = static_cast<uint32_t>(graph.size());
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+
+        // Pontas livres, com a posição de cada uma para remoção O(1)
+        std::vector<uint32_t> endpoints, slot(n, NONE);
+        for (uint32_t city = 0; city < n; ++city) {
+            if (otherEnd[city] == NONE || city == first || city == otherEnd[first]) continue;
+            slot[city] = static_cast<uint32_t>(endpoints.size());
+            endpoints.push_back(city);
+        }
+        auto remove = [&](uint32_t city) {
+            if (slot[city] == NONE) return;
+            uint32_t last = endpoints.back();
+            endpoints[slot[city]] = last;
+            slot[last] = slot[city];
+            endpoints.pop_back();
+            slot[city] = NONE;
+        };
+
+        uint32_t current = otherEnd[first];
+        while (!endpoints.empty()) {
+            uint32_t next = endpoints[0];
+            for (uint32_t city : endpoints) {
+                if (dist.at(current, city) < dist.at(current, next)) next = city;
+            }
+            remove(next);
+            remove(otherEnd[next]);
+            link(adjacency, current, next);
+            current = otherEnd[next];
+        }
+        link(adjacency, current, first);
+    }
+};
+
+#endif // GREEDYEDGETSP_H
@@ -0,0 +1,190 @@
+#ifndef HELDKARPTSP_H
+#define HELDKARPTSP_H
+
+#include <vector>
+#include <limits>
+#include <thread>
+#include <cstdint>
+#include <algorithm>
+
+#include "core/TSPAlgorithm.h"
+
+/**
+ * @brief Algoritmo exato de Held-Karp (programação dinâmica sobre subconjuntos)
+ *
+ * A cidade 0 é fixada como início; dp[S][j] é o menor caminho que parte de 0,
+ * visita exatamente o subconjunto S das demais cidades e termina em j.
+ * A tabela é organizada por subconjunto (subset-major: as entradas de um
+ * mesmo S são contíguas) e cada camada de mesma cardinalidade é calculada
+ * em paralelo, pois depende apenas da camada anterior.
+ *
+ * Complexidade O(2^n * n^2) em tempo e O(2^n * n) em memória. Instâncias
+ * cuja tabela em double não cabe no limite de memória são recusadas antes
+ * de qualquer alocação. Com setAllowFloat(true), uma tabela em float (metade
+ * da memória) é usada nesse caso; a soma em float pode errar o ótimo, e
+ * isLastResultExact() informa se a última rota veio da tabela em double.
+ */
+class HeldKarpTSP : public TSPAlgorithm {
+private:
+    size_t m_memoryLimit;
+    unsigned m_threads;
+    bool m_allowFloat = false;
+    bool m_lastResultExact = true;
+
+    static constexpr size_t MAX_POINTS = 32;
+
+    template <typename T>
+    std::vector<uint32_t> run(const Graph& graph) const {
+        const size_t n = graph.size();
+        const size_t m = n - 1;                 // cidades além da inicial
+        const uint32_t full = (m == 32) ? 0xFFFFFFFFu : ((1u << m) - 1);
+        const T INF = std::numeric_limits<T>::max();
+
+        // Distâncias locais densas (índices 0..m-1 representam as cidades 1..n-1)
+        const DistanceMatrix& matrix = graph.getDistanceMatrix();
+        std::vector<T> d(m * m), fromStart(m);
+        for (size_t a = 0; a < m; ++a) {
+            fromStart[a] = static_cast<T>(matrix.at(0, a + 1));
+            for (size_t b = 0; b < m; ++b) d[a * m + b] = static_cast<T>(matrix.at(a + 1, b + 1));
+        }
+
+        std::vector<T> dp((static_cast<size_t>(full) + 1) * m, INF);
+        for (size_t j = 0; j < m; ++j) dp[(size_t(1) << j) * m + j] = fromStart[j];
+
+        auto relax = [&](uint32_t mask) {
+            T* row = dp.data() + static_cast<size_t>(mask) * m;
+            for (uint32_t bits = mask; bits; bits &= bits - 1) {
+                unsigned j = __builtin_ctz(bits);
+                uint32_t prev = mask ^ (1u << j);
+                const T* prevRow = dp.data() + static_cast<size_t>(prev) * m;
+                T best = INF;
+                for (uint32_t pb = prev; pb; pb &= pb - 1) {
+                    unsigned k = __builtin_ctz(pb);
+                    T candidate = prevRow[k] + d[k * m + j];
+                    if (candidate < best) best = candidate;
+                }
+                row[j] = best;
+            }
+        };
+
+        unsigned threadCount = m_threads ? m_threads : std::thread::hardware_concurrency();
+        if (threadCount == 0) threadCount = 1;
+
+        std::vector<uint32_t> layer;
+        for (size_t card = 2; card <= m; ++card) {
+            // Enumera os subconjuntos de cardinalidade card (Gosper's hack)
+            layer.clear();
+            uint64_t mask = (uint64_t(1) << card) - 1;
+            while (mask <= full) {
+                layer.push_back(static_cast<uint32_t>(mask));
+                uint64_t c = mask & (~mask + 1);
+                uint64_t r = mask + c;
+                mask = (((r ^ mask) >> 2) / c) | r;
+            }
+
+            unsigned workers = layer.size() < 1024 ? 1 : threadCount;
+            if (workers == 1) {
+                for (uint32_t s : layer) relax(s);
+                continue;
+            }
+            std::vector<std::thread> pool;
+            size_t chunk = (layer.size() + workers - 1) / workers;
+            for (unsigned t = 0; t < workers; ++t) {
+                size_t begin = t * chunk, end = std::min(layer.size(), begin + chunk);
+                if (begin >= end) break;
+                pool.emplace_back([&, begin, end]() {
+                    for (size_t i = begin; i < end; ++i) relax(layer[i]);
+                });
+            }
+            for (auto& th : pool) th.join();
+        }
+
+        // Fecha o ciclo e reconstrói o caminho recalculando as transições
+        const T* lastRow = dp.data() + static_cast<size_t>(full) * m;
+        T best = INF;
+        unsigned last = 0;
+        for (unsigned j = 0; j < m; ++j) {
+            T candidate = lastRow[j] + fromStart[j];
+            if (candidate < best) { best = candidate; last = j; }
+        }
+
+        std::vector<uint32_t> order(n);
+        uint32_t mask = full;
+        unsigned j = last;
+        for (size_t pos = n - 1; pos >= 1; --pos) {
+            order[pos] = j + 1;
+            uint32_t prev = mask ^ (1u << j);
+            if (prev == 0) break;
+            const T target = dp[static_cast<size_t>(mask) * m + j];
+            const T* prevRow = dp.data() + static_cast<size_t>(prev) * m;
+            unsigned next = __builtin_ctz(prev);
+            for (uint32_t pb = prev; pb; pb &= pb - 1) {
+                unsigned k = __builtin_ctz(pb);
+                if (prevRow[k] + d[k * m + j] == target) { next = k; break; }
+            }
+            mask = prev;
+            j = next;
+        }
+        order[0] = 0;
+        return order;
+    }
+
+public:
+    /**
+     * @param memoryLimit Memória máxima para a tabela DP (bytes)
+     * @param threads Número de threads (0 = hardware_concurrency())
+     */
+    explicit HeldKarpTSP(size_t memoryLimit = size_t(2) << 30, unsigned threads = 0)
+        : m_memoryLimit(memoryLimit), m_threads(threads) {}
+
+    /**
+     * @brief Memória estimada da tabela DP para n cidades (bytes)
+     */
+    static size_t estimateMemory(size_t n, size_t valueSize = sizeof(double)) {
+        if (n < 2) return 0;
+        if (n - 1 >= 8 * sizeof(size_t) - 8) return std::numeric_limits<size_t>::max();
+        return (size_t(1) << (n - 1)) * (n - 1) * valueSize;
+    }
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        if (graph.size() > MAX_POINTS + 1) {
+            throw TSPException("Held-Karp supports at most 33 points");
+        }
+
+        std::vector<uint32_t> order;
+        m_lastResultExact = true;
+        if (graph.size() <= 3) {
+            for (size_t i = 0; i < graph.size(); ++i) order.push_back(static_cast<uint32_t>(i));
+        } else if (estimateMemory(graph.size(), sizeof(double)) <= m_memoryLimit) {
+            order = run<double>(graph);
+        } else if (m_allowFloat && estimateMemory(graph.size(), sizeof(float)) <= m_memoryLimit) {
+            order = run<float>(graph);
+            m_lastResultExact = false;
+        } else {
+            throw TSPException("Held-Karp table would exceed the memory limit");
+        }
+
+        recordExecutionTime(start);
+        return Route(graph, std::move(order));
+    }
+
+    void setMemoryLimit(size_t bytes) { m_memoryLimit = bytes; }
+    size_t getMemoryLimit() const { return m_memoryLimit; }
+
+    /// Permite a tabela em float quando a de double não cabe (resultado aproximado)
+    void setAllowFloat(bool allow) { m_allowFloat = allow; }
+    bool getAllowFloat() const { return m_allowFloat; }
+
+    /// false se a última rota veio da tabela em float
+    bool isLastResultExact() const { return m_lastResultExact; }
+
+    std::string getName() const override { return "Held-Karp"; }
+    std::string getDescription() const override {
+        return "Exact dynamic programming over subsets (bitmask DP)";
+    }
+};
+
+#endif // HELDKARPTSP_H
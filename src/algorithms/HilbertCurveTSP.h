@@ -0,0 +1,64 @@
+#ifndef HILBERTCURVETSP_H
+#define HILBERTCURVETSP_H
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <unordered_map>
+
+#include "core/TSPAlgorithm.h"
+#include "core/ThreadPool.h"
+#include "core/SpaceFillingCurve.h"
+
+/**
+ * @brief Construção pela curva de Hilbert (space-filling curve)
+ *
+ * A rota visita as cidades na ordem em que a curva de Hilbert passa pelas
+ * suas células. Não consulta distâncias nem índices espaciais: o custo é
+ * quantizar as coordenadas e um radix sort paralelo, O(n), o que torna o
+ * método adequado como primeiro passo em instâncias de milhões de pontos.
+ * Em pontos uniformes a rota fica cerca de 35-40% acima do ótimo e
+ * serve de ponto de partida para Or-opt / 2-opt / Lin-Kernighan.
+ *
+ * Parâmetros (setParameters): threads.
+ */
+class HilbertCurveTSP : public TSPAlgorithm {
+private:
+    unsigned m_threads;
+
+public:
+    /**
+     * @param threads Threads usadas (0 = hardware_concurrency())
+     */
+    explicit HilbertCurveTSP(unsigned threads = 0) : m_threads(threads) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+
+        ThreadPool pool(m_threads);
+        std::vector<uint32_t> order = SpaceFillingCurve::hilbertOrder(
+            graph.xData(), graph.yData(), graph.size(), pool);
+
+        // Como os demais construtivos, a rota começa na cidade 0
+        std::rotate(order.begin(), std::find(order.begin(), order.end(), 0u), order.end());
+        Route route(graph, std::move(order));
+
+        recordExecutionTime(start);
+        return route;
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "threads") m_threads = static_cast<unsigned>(value);
+        }
+    }
+
+    std::string getName() const override { return "Hilbert Curve"; }
+    std::string getDescription() const override {
+        return "Visits cities in Hilbert space-filling-curve order (parallel radix sort)";
+    }
+};
+
+#endif // HILBERTCURVETSP_H
@@ -0,0 +1,441 @@
+#ifndef INSERTIONTSP_H
+#define INSERTIONTSP_H
+
+#include <vector>
+#include <queue>
+#include <string>
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+
+#include "core/TSPAlgorithm.h"
+#include "core/CandidateLists.h"
+#include "core/KDTree.h"
+
+/**
+ * @brief Base das heurísticas de inserção (cheapest, nearest, farthest, convex hull)
+ *
+ * A rota parcial é uma lista duplamente ligada (next/prev por cidade), então
+ * cada inserção custa O(1); a Route só é montada no final. As subclasses
+ * escolhem a rota inicial e a regra de seleção da próxima cidade; a cidade
+ * escolhida é sempre inserida na posição mais barata.
+ *
+ * As posições avaliadas para uma cidade c são as arestas da rota que tocam
+ * seus k vizinhos mais próximos já roteados (ou, se nenhum foi roteado,
+ * as dos vizinhos roteados mais próximos, via KDTree; com GEO ou matriz
+ * explícita, cujas distâncias não seguem as coordenadas, todas as arestas
+ * da rota são avaliadas). Cada cidade guarda em cache sua melhor
+ * inserção; depois de inserir t entre a e b, só são recalculadas as
+ * cidades que têm t, a ou b entre seus candidatos (listas reversas).
+ *
+ * Demonstra conceitos POO:
+ * - Template Method: solve() é fixo, as subclasses definem seleção e semente
+ * - Herança e polimorfismo
+ */
+class InsertionTSP : public TSPAlgorithm {
+protected:
+    enum class Selection {
+        Cheapest,   ///< Menor custo de inserção
+        Nearest,    ///< Mais próxima da rota
+        Farthest    ///< Mais distante da rota
+    };
+
+    static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    /// Cidades roteadas consultadas quando nenhum candidato está na rota
+    static constexpr size_t FALLBACK_NEIGHBORS = 4;
+
+    size_t m_neighborCount;
+    unsigned m_threads;
+
+    explicit InsertionTSP(size_t neighborCount, unsigned threads)
+        : m_neighborCount(std::max<size_t>(1, neighborCount)), m_threads(threads) {}
+
+    virtual Selection selection() const = 0;
+
+    /**
+     * @brief Rota inicial (ao menos 2 cidades distintas), na ordem do ciclo
+     *
+     * Padrão: a cidade 0 e seu vizinho mais próximo.
+     */
+    virtual std::vector<uint32_t> initialTour(const Graph& graph, const CandidateLists& candidates) const {
+        (void)graph;
+        return {0, candidates.of(0)[0]};
+    }
+
+private:
+    /// Inserir entre after e before (= next[after] no momento do cálculo)
+    struct Insertion {
+        double cost = std::numeric_limits<double>::infinity();
+        uint32_t after = NONE;
+        uint32_t before = NONE;
+    };
+
+    using Entry = std::pair<double, uint32_t>;
+
+    /// Estado de uma construção; vive apenas durante solve()
+    class Builder {
+    public:
+        const Graph& graph;
+        const DistanceMatrix& dist;
+        const CandidateLists& candidates;
+        std::vector<uint32_t> reverseOffset;    ///< CSR das listas reversas
+        std::vector<uint32_t> reverseList;
+        std::vector<uint32_t> next, prev;
+        std::vector<uint8_t> routed;
+        std::vector<Insertion> best;
+        const bool spatial;                     ///< A métrica segue as coordenadas (KDTree)
+        KDTree routedIndex;                     ///< Cidades roteadas, se spatial
+        std::vector<uint32_t> routedList;       ///< Cidades roteadas, se não spatial
+        size_t routedCount = 0;
+
+        Builder(const Graph& g, const CandidateLists& c)
+            : graph(g), dist(g.getDistanceMatrix()), candidates(c),
+              next(g.size(), NONE), prev(g.size(), NONE), routed(g.size(), 0),
+              best(g.size()), spatial(followsCoordinates(g.getDistanceConfig().metric)) {
+            const size_t n = g.size(), k = c.k();
+            reverseOffset.assign(n + 1, 0);
+            for (uint32_t i = 0; i < n; ++i) {
+                for (size_t t = 0; t < k; ++t) ++reverseOffset[c.of(i)[t] + 1];
+            }
+            for (size_t i = 0; i < n; ++i) reverseOffset[i + 1] += reverseOffset[i];
+            reverseList.resize(n * k);
+            std::vector<uint32_t> fill(reverseOffset.begin(), reverseOffset.end() - 1);
+            for (uint32_t i = 0; i < n; ++i) {
+                for (size_t t = 0; t < k; ++t) reverseList[fill[c.of(i)[t]]++] = i;
+            }
+            if (spatial) {
+                routedIndex.build(g.xData(), g.yData(), n);
+                routedIndex.removeAll();
+            } else {
+                routedList.reserve(n);
+            }
+        }
+
+        double d(uint32_t a, uint32_t b) const { return dist.at(a, b); }
+
+        void route(uint32_t city) {
+            routed[city] = 1;
+            if (spatial) routedIndex.restore(city);
+            else routedList.push_back(city);
+            ++routedCount;
+        }
+
+        void seed(const std::vector<uint32_t>& tour) {
+            for (size_t i = 0; i < tour.size(); ++i) {
+                uint32_t a = tour[i], b = tour[(i + 1) % tour.size()];
+                next[a] = b;
+                prev[b] = a;
+                route(a);
+            }
+        }
+
+        bool valid(const Insertion& ins) const {
+            return ins.after != NONE && next[ins.after] == ins.before;
+        }
+
+        Insertion bestInsertion(uint32_t c) const {
+            Insertion result;
+            auto tryEdge = [&](uint32_t a) {
+                uint32_t b = next[a];
+                double cost = d(a, c) + d(c, b) - d(a, b);
+                if (cost < result.cost) result = {cost, a, b};
+            };
+            const uint32_t* neighbors = candidates.of(c);
+            for (size_t t = 0; t < candidates.k(); ++t) {
+                uint32_t u = neighbors[t];
+                if (!routed[u]) continue;
+                tryEdge(u);
+                tryEdge(prev[u]);
+            }
+            if (result.after == NONE && !spatial) {
+                for (uint32_t u : routedList) tryEdge(u);
+            } else if (result.after == NONE) {
+                auto nearest = routedIndex.kNearest(graph.getX(c), graph.getY(c), FALLBACK_NEIGHBORS);
+                for (const auto& neighbor : nearest) {
+                    tryEdge(neighbor.second);
+                    tryEdge(prev[neighbor.second]);
+                }
+            }
+            return result;
+        }
+
+        /// Distância da cidade à rota parcial (exata: KDTree ou varredura)
+        double distanceToTour(uint32_t c) const {
+            if (spatial) return d(c, routedIndex.nearest(graph.getX(c), graph.getY(c)));
+            double nearest = std::numeric_limits<double>::infinity();
+            for (uint32_t u : routedList) nearest = std::min(nearest, d(c, u));
+            return nearest;
+        }
+
+        void insert(uint32_t c, const Insertion& ins) {
+            uint32_t a = ins.after, b = next[a];
+            next[a] = c;
+            prev[c] = a;
+            next[c] = b;
+            prev[b] = c;
+            route(c);
+        }
+
+        /// Cidades não roteadas que têm city entre seus candidatos
+        template <typename Visit>
+        void forEachReverse(uint32_t city, Visit&& visit) const {
+            for (uint32_t i = reverseOffset[city]; i < reverseOffset[city + 1]; ++i) {
+                if (!routed[reverseList[i]]) visit(reverseList[i]);
+            }
+        }
+    };
+
+    Route cheapestInsertion(Builder& b) const {
+        const uint32_t n = static_cast<uint32_t>(b.graph.size());
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+        for (uint32_t c = 0; c < n; ++c) {
+            if (b.routed[c]) continue;
+            b.best[c] = b.bestInsertion(c);
+            heap.push({b.best[c].cost, c});
+        }
+
+        auto refresh = [&](uint32_t c) {
+            b.best[c] = b.bestInsertion(c);
+            heap.push({b.best[c].cost, c});
+        };
+
+        while (b.routedCount < n) {
+            auto [cost, c] = heap.top();
+            heap.pop();
+            if (b.routed[c] || cost != b.best[c].cost) continue;    // entrada antiga
+            if (!b.valid(b.best[c])) {
+                refresh(c);
+                continue;
+            }
+            Insertion ins = b.best[c];
+            b.insert(c, ins);
+            b.forEachReverse(c, refresh);
+            b.forEachReverse(ins.after, refresh);
+            b.forEachReverse(ins.before, refresh);
+        }
+        return walk(b);
+    }
+
+    Route nearestInsertion(Builder& b) const {
+        const uint32_t n = static_cast<uint32_t>(b.graph.size());
+        // Distância à rota: exata no início, depois atualizada pelas listas
+        // reversas (exata sempre que a cidade roteada mais próxima é candidata)
+        std::vector<double> key(n, 0.0);
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+        for (uint32_t c = 0; c < n; ++c) {
+            if (b.routed[c]) continue;
+            key[c] = b.distanceToTour(c);
+            heap.push({key[c], c});
+        }
+
+        while (b.routedCount < n) {
+            auto [distance, c] = heap.top();
+            heap.pop();
+            if (b.routed[c] || distance != key[c]) continue;
+            b.insert(c, b.bestInsertion(c));
+            b.forEachReverse(c, [&](uint32_t other) {
+                double d = b.d(other, c);
+                if (d < key[other]) {
+                    key[other] = d;
+                    heap.push({d, other});
+                }
+            });
+        }
+        return walk(b);
+    }
+
+    Route farthestInsertion(Builder& b) const {
+        const uint32_t n = static_cast<uint32_t>(b.graph.size());
+        // A distância à rota só diminui, então a chave guardada é um limite
+        // superior: ao sair do heap é recalculada e, se caiu, a cidade volta
+        std::priority_queue<Entry> heap;
+        for (uint32_t c = 0; c < n; ++c) {
+            if (!b.routed[c]) heap.push({b.distanceToTour(c), c});
+        }
+
+        while (b.routedCount < n) {
+            auto [bound, c] = heap.top();
+            heap.pop();
+            if (b.routed[c]) continue;
+            double distance = b.distanceToTour(c);
+            if (distance < bound && !heap.empty() && distance < heap.top().first) {
+                heap.push({distance, c});
+                continue;
+            }
+            b.insert(c, b.bestInsertion(c));
+        }
+        return walk(b);
+    }
+
+    /// Monta a Route percorrendo a lista a partir da cidade 0
+    static Route walk(const Builder& b) {
+        Route route(b.graph);
+        route.reserve(b.graph.size());
+        uint32_t city = 0;
+        do {
+            route.addPoint(city);
+            city = b.next[city];
+        } while (city != 0);
+        return route;
+    }
+
+public:
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        if (graph.size() <= 3) {
+            std::vector<uint32_t> order(graph.size());
+            for (size_t i = 0; i < order.size(); ++i) order[i] = static_cast<uint32_t>(i);
+            recordExecutionTime(start);
+            return Route(graph, std::move(order));
+        }
+
+        CandidateLists candidates(graph, m_neighborCount, m_threads);
+        Builder builder(graph, candidates);
+        builder.seed(initialTour(graph, candidates));
+
+        Route route;
+        switch (selection()) {
+            case Selection::Cheapest: route = cheapestInsertion(builder); break;
+            case Selection::Nearest:  route = nearestInsertion(builder); break;
+            case Selection::Farthest: route = farthestInsertion(builder); break;
+        }
+
+        recordExecutionTime(start);
+        return route;
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            // initialTour e as listas reversas precisam de ao menos um vizinho
+            if (key == "neighbor_count") m_neighborCount = std::max<size_t>(1, static_cast<size_t>(value));
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+        }
+    }
+};
+
+/**
+ * @brief Inserção mais barata: insere a cidade com menor custo de inserção
+ */
+class CheapestInsertionTSP : public InsertionTSP {
+protected:
+    Selection selection() const override { return Selection::Cheapest; }
+
+public:
+    explicit CheapestInsertionTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : InsertionTSP(neighborCount, threads) {}
+
+    std::string getName() const override { return "Cheapest Insertion"; }
+    std::string getDescription() const override {
+        return "Inserts the city with the lowest insertion cost at its best position";
+    }
+};
+
+/**
+ * @brief Inserção do mais próximo: insere a cidade mais próxima da rota
+ */
+class NearestInsertionTSP : public InsertionTSP {
+protected:
+    Selection selection() const override { return Selection::Nearest; }
+
+public:
+    explicit NearestInsertionTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : InsertionTSP(neighborCount, threads) {}
+
+    std::string getName() const override { return "Nearest Insertion"; }
+    std::string getDescription() const override {
+        return "Inserts the city closest to the tour at its cheapest position";
+    }
+};
+
+/**
+ * @brief Inserção do mais distante: insere a cidade mais longe da rota
+ *
+ * Começa pela cidade 0 e a cidade mais distante dela; o contorno geral é
+ * fixado cedo e os detalhes são preenchidos depois, o que costuma dar
+ * rotas melhores que cheapest/nearest.
+ */
+class FarthestInsertionTSP : public InsertionTSP {
+protected:
+    Selection selection() const override { return Selection::Farthest; }
+
+    std::vector<uint32_t> initialTour(const Graph& graph, const CandidateLists&) const override {
+        uint32_t farthest = 1;
+        double farthestDistance = -1.0;
+        for (uint32_t i = 1; i < graph.size(); ++i) {
+            double d = graph.getDistanceMatrix().at(0, i);
+            if (d > farthestDistance) {
+                farthestDistance = d;
+                farthest = i;
+            }
+        }
+        return {0, farthest};
+    }
+
+public:
+    explicit FarthestInsertionTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : InsertionTSP(neighborCount, threads) {}
+
+    std::string getName() const override { return "Farthest Insertion"; }
+    std::string getDescription() const override {
+        return "Inserts the city farthest from the tour at its cheapest position";
+    }
+};
+
+/**
+ * @brief Inserção mais barata a partir do fecho convexo
+ *
+ * A rota ótima visita os vértices do fecho convexo na ordem do fecho, então
+ * ele é uma boa semente; o fecho é obtido pela cadeia monótona de Andrew
+ * (O(n log n)). As demais cidades entram por inserção mais barata.
+ */
+class ConvexHullInsertionTSP : public InsertionTSP {
+protected:
+    Selection selection() const override { return Selection::Cheapest; }
+
+    std::vector<uint32_t> initialTour(const Graph& graph, const CandidateLists& candidates) const override {
+        std::vector<uint32_t> points(graph.size());
+        for (size_t i = 0; i < points.size(); ++i) points[i] = static_cast<uint32_t>(i);
+        std::sort(points.begin(), points.end(), [&](uint32_t a, uint32_t b) {
+            if (graph.getX(a) != graph.getX(b)) return graph.getX(a) < graph.getX(b);
+            return graph.getY(a) < graph.getY(b);
+        });
+
+        auto cross = [&](uint32_t o, uint32_t a, uint32_t b) {
+            return (graph.getX(a) - graph.getX(o)) * (graph.getY(b) - graph.getY(o)) -
+                   (graph.getY(a) - graph.getY(o)) * (graph.getX(b) - graph.getX(o));
+        };
+
+        std::vector<uint32_t> hull(2 * points.size());
+        size_t count = 0;
+        for (uint32_t p : points) {                                  // parte inferior
+            while (count >= 2 && cross(hull[count - 2], hull[count - 1], p) <= 0) --count;
+            hull[count++] = p;
+        }
+        for (size_t i = points.size() - 1, lower = count + 1; i-- > 0;) {   // superior
+            uint32_t p = points[i];
+            while (count >= lower && cross(hull[count - 2], hull[count - 1], p) <= 0) --count;
+            hull[count++] = p;
+        }
+        hull.resize(count - 1);
+
+        // Pontos colineares: o fecho degenera e a semente padrão serve
+        if (hull.size() < 3) return InsertionTSP::initialTour(graph, candidates);
+        return hull;
+    }
+
+public:
+    explicit ConvexHullInsertionTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : InsertionTSP(neighborCount, threads) {}
+
+    std::string getName() const override { return "Convex Hull Insertion"; }
+    std::string getDescription() const override {
+        return "Starts from the convex hull and adds cities by cheapest insertion";
+    }
+};
+
+#endif // INSERTIONTSP_H
@@ -0,0 +1,318 @@
+#ifndef LINKERNIGHANTSP_H
+#define LINKERNIGHANTSP_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+
+#include "core/TSPAlgorithm.h"
+#include "core/CandidateLists.h"
+#include "core/TourArray.h"
+#include "algorithms/NearestNeighborTSP.h"
+
+/**
+ * @brief Melhoria de profundidade variável no estilo Lin-Kernighan
+ *
+ * A partir de t1, remove a aresta t1-t2 e constrói uma cadeia de trocas
+ * sequenciais: em cada nível escolhe t3 entre os candidatos de t2 (com
+ * ganho parcial positivo), remove t3-t4 e aplica o 2-opt equivalente, de
+ * modo que a rota continua válida e o ganho de fechar a cadeia (ligar t4
+ * a t1) é conhecido em O(1). A cadeia para ao achar ganho ao fechar ou ao
+ * atingir a profundidade máxima; os primeiros níveis tentam mais de um t3
+ * (backtracking limitado) e os demais seguem apenas o melhor.
+ *
+ * Arestas adicionadas na cadeia não podem ser removidas na mesma cadeia.
+ * Cidades tocadas por uma melhoria voltam à fila (don't-look bits).
+ *
+ * Parâmetros (setParameters): neighbor_count, max_depth, threads (listas
+ * de candidatos), time_limit_ms; os demais são repassados ao construtivo.
+ */
+class LinKernighanTSP : public TSPAlgorithm, public TSPImprover {
+private:
+    std::unique_ptr<TSPAlgorithm> m_initialSolver;
+    size_t m_neighborCount;
+    size_t m_maxDepth;
+    long m_timeLimitMs;
+    unsigned m_threads = 0;
+    uint64_t m_improvements;
+
+    static constexpr double EPSILON = 1e-10;
+    /// t3 tentados por nível; os níveis seguintes usam o último valor
+    static constexpr size_t BREADTH[] = {5, 3, 1};
+
+    struct Step { uint32_t t1, t2, t3, t4; };
+
+    /**
+     * @brief Visão da rota com as reversões da cadeia ainda não aplicadas
+     *
+     * A rota é uma sequência de intervalos de posições do TourArray, cada
+     * um percorrido em sentido direto ou inverso. Uma cadeia de k trocas
+     * gera no máximo 2k+1 intervalos, então sucessor, predecessor e
+     * reversão custam O(k) em vez de O(n). Só a cadeia aceita é aplicada
+     * no array.
+     */
+    class SegmentTour {
+    public:
+        struct Segment { uint32_t first, last; bool reversed; };
+
+    private:
+        const TourArray& m_tour;
+        std::vector<Segment> m_segments;
+
+        size_t find(uint32_t position) const {
+            for (size_t i = 0; i < m_segments.size(); ++i) {
+                if (m_segments[i].first <= position && position <= m_segments[i].last) return i;
+            }
+            return 0;
+        }
+
+        uint32_t head(const Segment& s) const { return m_tour.at(s.reversed ? s.last : s.first); }
+        uint32_t tail(const Segment& s) const { return m_tour.at(s.reversed ? s.first : s.last); }
+
+        /// Divide o intervalo que contém city para que city inicie (ou termine) um intervalo
+        void split(uint32_t city, bool startsSegment) {
+            uint32_t p = m_tour.pos(city);
+            size_t i = find(p);
+            Segment s = m_segments[i];
+            // Corte antes de p (no array) quando city inicia um intervalo direto
+            bool cutBefore = startsSegment != s.reversed;
+            if (cutBefore ? p == s.first : p == s.last) return;
+
+            Segment low = s, high = s;
+            if (cutBefore) { low.last = p - 1; high.first = p; }
+            else { low.last = p; high.first = p + 1; }
+            m_segments[i] = s.reversed ? high : low;
+            m_segments.insert(m_segments.begin() + i + 1, s.reversed ? low : high);
+        }
+
+    public:
+        explicit SegmentTour(const TourArray& tour) : m_tour(tour) { reset(); }
+
+        void reset() {
+            m_segments.assign(1, Segment{0, static_cast<uint32_t>(m_tour.size() - 1), false});
+        }
+
+        uint32_t succ(uint32_t city) const {
+            uint32_t p = m_tour.pos(city);
+            size_t i = find(p);
+            const Segment& s = m_segments[i];
+            if (!s.reversed && p < s.last) return m_tour.at(p + 1);
+            if (s.reversed && p > s.first) return m_tour.at(p - 1);
+            return head(m_segments[(i + 1) % m_segments.size()]);
+        }
+
+        uint32_t pred(uint32_t city) const {
+            uint32_t p = m_tour.pos(city);
+            size_t i = find(p);
+            const Segment& s = m_segments[i];
+            if (!s.reversed && p > s.first) return m_tour.at(p - 1);
+            if (s.reversed && p < s.last) return m_tour.at(p + 1);
+            return tail(m_segments[(i + m_segments.size() - 1) % m_segments.size()]);
+        }
+
+        /// Inverte o caminho de from até to, seguindo succ
+        void reversePath(uint32_t from, uint32_t to) {
+            split(from, true);
+            split(to, false);
+            size_t i = find(m_tour.pos(from));
+            std::rotate(m_segments.begin(), m_segments.begin() + i, m_segments.end());
+            size_t j = find(m_tour.pos(to));
+            std::reverse(m_segments.begin(), m_segments.begin() + j + 1);
+            for (size_t k = 0; k <= j; ++k) m_segments[k].reversed = !m_segments[k].reversed;
+        }
+
+        const std::vector<Segment>& segments() const { return m_segments; }
+        void restore(const std::vector<Segment>& saved) { m_segments = saved; }
+    };
+
+    struct Search {
+        const DistanceMatrix& dist;
+        const CandidateLists& candidates;
+        SegmentTour view;
+        size_t maxDepth;
+        bool forward = true;
+        std::vector<Step> chain;
+        std::vector<std::pair<uint32_t, uint32_t>> added;
+        std::vector<std::pair<double, uint32_t>> choices;
+        std::vector<std::vector<SegmentTour::Segment>> saved;
+
+        Search(const DistanceMatrix& d, const CandidateLists& c, const TourArray& tour, size_t depth)
+            : dist(d), candidates(c), view(tour), maxDepth(depth), saved(depth) {}
+
+        double d(uint32_t a, uint32_t b) const { return dist.at(a, b); }
+
+        bool wasAdded(uint32_t a, uint32_t b) const {
+            for (const auto& edge : added) {
+                if ((edge.first == a && edge.second == b) || (edge.first == b && edge.second == a)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Estende a cadeia: a rota contém a aresta t1-t2 a ser removida
+         * @param gain Soma das arestas removidas menos as adicionadas até aqui
+         */
+        bool extend(size_t level, uint32_t t1, uint32_t t2, double gain) {
+            size_t breadth = BREADTH[std::min(level, std::size(BREADTH) - 1)];
+
+            // Candidatos t3 ordenados pelo ganho com t3-t4 removida
+            size_t begin = choices.size();
+            const uint32_t* neighbors = candidates.of(t2);
+            for (size_t i = 0; i < candidates.k(); ++i) {
+                uint32_t t3 = neighbors[i];
+                double g1 = gain - d(t2, t3);
+                if (g1 <= EPSILON) break;
+                if (t3 == t1) continue;
+                uint32_t t4 = forward ? view.pred(t3) : view.succ(t3);
+                if (t4 == t2 || wasAdded(t3, t4)) continue;
+                choices.emplace_back(g1 + d(t3, t4), t3);
+            }
+            std::sort(choices.begin() + begin, choices.end(),
+                      [](const auto& a, const auto& b) { return a.first > b.first; });
+            size_t end = std::min(choices.size(), begin + breadth);
+
+            for (size_t c = begin; c < end; ++c) {
+                uint32_t t3 = choices[c].second;
+                uint32_t t4 = forward ? view.pred(t3) : view.succ(t3);
+                double next = choices[c].first;
+
+                // Remove t1-t2 e t4-t3, adiciona t2-t3 e t1-t4
+                saved[level] = view.segments();
+                if (forward) view.reversePath(t2, t4);
+                else view.reversePath(t4, t2);
+                chain.push_back({t1, t2, t3, t4});
+                added.emplace_back(t2, t3);
+
+                if (next - d(t4, t1) > EPSILON ||
+                    (level + 1 < maxDepth && extend(level + 1, t1, t4, next))) {
+                    choices.resize(begin);
+                    return true;
+                }
+
+                view.restore(saved[level]);
+                chain.pop_back();
+                added.pop_back();
+            }
+            choices.resize(begin);
+            return false;
+        }
+
+        /**
+         * @brief Procura uma cadeia de melhoria que começa removendo t1-t2
+         */
+        bool start(uint32_t t1, uint32_t t2, bool forwardChain) {
+            view.reset();
+            forward = forwardChain;
+            chain.clear();
+            added.clear();
+            return extend(0, t1, t2, d(t1, t2));
+        }
+    };
+
+public:
+    explicit LinKernighanTSP(std::unique_ptr<TSPAlgorithm> initialSolver = std::make_unique<NearestNeighborTSP>(),
+                             size_t neighborCount = 8, size_t maxDepth = 5)
+        : m_initialSolver(std::move(initialSolver)), m_neighborCount(neighborCount),
+          m_maxDepth(maxDepth), m_timeLimitMs(0), m_improvements(0) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        Route initial = m_initialSolver ? m_initialSolver->solve(graph)
+                                        : NearestNeighborTSP().solve(graph);
+        Route route = improve(initial);
+        // improve() registra só o próprio tempo; solve() inclui o construtivo
+        recordExecutionTime(start);
+        return route;
+    }
+
+    /**
+     * @brief Melhora uma rota existente (warm start)
+     * @param start Rota inicial, vinculada a um Graph
+     */
+    Route improve(const Route& start) override {
+        auto begin = Clock::now();
+        const Graph* graph = start.getGraph();
+        if (!graph) throw TSPException("Route is not bound to a graph");
+        if (!start.visitsEveryCity()) throw TSPException("Route must visit every city of its graph");
+        m_improvements = 0;
+
+        if (start.size() < 5 || m_maxDepth == 0) {
+            recordExecutionTime(begin);
+            return start;
+        }
+
+        const DistanceMatrix& dist = graph->getDistanceMatrix();
+        CandidateLists candidates(*graph, m_neighborCount, m_threads);
+        TourArray tour(start.getSequence());
+        Search search(dist, candidates, tour, m_maxDepth);
+
+        std::deque<uint32_t> queue;
+        std::vector<uint8_t> active(graph->size(), 0);
+        for (uint32_t city : start.getSequence()) {
+            queue.push_back(city);
+            active[city] = 1;
+        }
+        auto activate = [&](uint32_t city) {
+            if (!active[city]) {
+                active[city] = 1;
+                queue.push_back(city);
+            }
+        };
+
+        auto deadline = begin + std::chrono::milliseconds(m_timeLimitMs);
+        size_t iterations = 0;
+        while (!queue.empty()) {
+            if (m_timeLimitMs > 0 && (++iterations & 255) == 0 && Clock::now() > deadline) break;
+            uint32_t t1 = queue.front();
+            queue.pop_front();
+            active[t1] = 0;
+
+            for (int direction = 0; direction < 2; ++direction) {
+                uint32_t t2 = direction == 0 ? tour.next(t1) : tour.prev(t1);
+                if (!search.start(t1, t2, direction == 0)) continue;
+
+                // Aplica no array apenas a cadeia aceita
+                ++m_improvements;
+                for (const Step& step : search.chain) {
+                    tour.twoOptMove(step.t1, step.t2, step.t4, step.t3);
+                    for (uint32_t city : {step.t1, step.t2, step.t3, step.t4}) activate(city);
+                }
+                break;
+            }
+        }
+
+        Route result(*graph, tour.orderFrom(start[0]));
+        recordExecutionTime(begin);
+        return result;
+    }
+
+    void setNeighborCount(size_t k) { m_neighborCount = k; }
+    /// Profundidade máxima da cadeia de trocas (1 = 2-opt)
+    void setMaxDepth(size_t depth) { m_maxDepth = depth; }
+    /// Limite de tempo em ms (0 = sem limite)
+    void setTimeLimit(long milliseconds) override { m_timeLimitMs = milliseconds; }
+    uint64_t getImprovements() const { return m_improvements; }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "neighbor_count") m_neighborCount = static_cast<size_t>(value);
+            else if (key == "max_depth") m_maxDepth = static_cast<size_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+            else if (key == "time_limit_ms") m_timeLimitMs = static_cast<long>(value);
+        }
+        if (m_initialSolver) m_initialSolver->setParameters(params);
+    }
+
+    std::string getName() const override { return "Lin-Kernighan"; }
+    std::string getDescription() const override {
+        return "Variable-depth sequential exchanges over k-nearest neighbor lists";
+    }
+};
+
+#endif // LINKERNIGHANTSP_H
@@ -0,0 +1,175 @@
+#ifndef LOCALSEARCH_H
+#define LOCALSEARCH_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <cstdint>
+
+#include "core/DistanceMatrix.h"
+#include "core/CandidateLists.h"
+#include "core/TourArray.h"
+
+/**
+ * @brief Estado compartilhado pelos movimentos durante a busca local
+ */
+struct LocalSearchContext {
+    const DistanceMatrix& dist;
+    const CandidateLists& candidates;
+    TourArray& tour;
+
+    double d(uint32_t a, uint32_t b) const { return dist.at(a, b); }
+};
+
+/**
+ * @brief Movimento encontrado por uma estratégia, ainda não aplicado
+ *
+ * delta é a variação do comprimento da rota (negativo = melhoria). As
+ * cidades listadas têm a vizinhança alterada pelo movimento e voltam à
+ * fila de cidades ativas; o significado de cada posição e de variant é
+ * definido pela estratégia que criou a proposta.
+ */
+struct MoveProposal {
+    double delta = 0.0;
+    uint32_t cities[6] = {0, 0, 0, 0, 0, 0};
+    uint8_t cityCount = 0;
+    uint8_t variant = 0;
+};
+
+/**
+ * @brief Estratégia de movimento da busca local (interface)
+ *
+ * Demonstra conceitos POO:
+ * - Strategy: cada tipo de movimento é intercambiável no motor
+ * - Polimorfismo: findImprovement/apply são virtuais puros
+ */
+class LocalSearchMove {
+public:
+    virtual ~LocalSearchMove() = default;
+
+    /**
+     * @brief Procura um movimento de melhoria envolvendo a cidade city
+     * @return true se proposal recebeu um movimento com delta negativo
+     */
+    virtual bool findImprovement(uint32_t city, const LocalSearchContext& context,
+                                 MoveProposal& proposal) const = 0;
+
+    /**
+     * @brief Aplica na rota um movimento retornado por findImprovement
+     */
+    virtual void apply(const MoveProposal& proposal, LocalSearchContext& context) const = 0;
+
+    /// Menor rota em que o movimento é válido
+    virtual size_t minTourSize() const { return 4; }
+
+    virtual std::string getName() const = 0;
+};
+
+/**
+ * @brief Motor de busca local com fila de cidades ativas (don't-look bits)
+ *
+ * Cada cidade retirada da fila é oferecida aos movimentos na ordem em que
+ * foram registrados; o primeiro que encontra melhoria é aplicado e as
+ * cidades afetadas voltam à fila. Assim combinar movimentos não exige
+ * passadas extras sobre a rota: todos compartilham a mesma fila, as
+ * mesmas listas de candidatos e a mesma avaliação de delta.
+ */
+class LocalSearch {
+public:
+    /// Contadores por tipo de movimento, para ajuste de parâmetros
+    struct MoveStats {
+        std::string name;
+        uint64_t attempts = 0;     ///< Cidades avaliadas pelo movimento
+        uint64_t accepted = 0;     ///< Movimentos aplicados
+        double gain = 0.0;         ///< Redução total de comprimento
+    };
+
+    static constexpr double EPSILON = 1e-10;
+
+private:
+    using Clock = std::chrono::high_resolution_clock;
+
+    std::vector<std::unique_ptr<LocalSearchMove>> m_moves;
+    std::vector<MoveStats> m_stats;
+    long m_timeLimitMs = 0;
+
+public:
+    void addMove(std::unique_ptr<LocalSearchMove> move) {
+        MoveStats stats;
+        stats.name = move->getName();
+        m_stats.push_back(stats);
+        m_moves.push_back(std::move(move));
+    }
+
+    size_t moveCount() const { return m_moves.size(); }
+
+    /// Limite de tempo em ms (0 = sem limite)
+    void setTimeLimit(long milliseconds) { m_timeLimitMs = milliseconds; }
+    long getTimeLimit() const { return m_timeLimitMs; }
+
+    /**
+     * @brief Executa a busca até o ótimo local (ou até o limite de tempo)
+     */
+    void run(TourArray& tour, const DistanceMatrix& dist, const CandidateLists& candidates) {
+        auto begin = Clock::now();
+        for (auto& stats : m_stats) {
+            stats.attempts = 0;
+            stats.accepted = 0;
+            stats.gain = 0.0;
+        }
+
+        const size_t n = tour.size();
+        LocalSearchContext context{dist, candidates, tour};
+
+        std::deque<uint32_t> queue;
+        std::vector<uint8_t> active(n, 0);
+        for (size_t i = 0; i < n; ++i) {
+            queue.push_back(tour.at(i));
+            active[tour.at(i)] = 1;
+        }
+
+        auto activate = [&](uint32_t city) {
+            if (!active[city]) {
+                active[city] = 1;
+                queue.push_back(city);
+            }
+        };
+
+        auto deadline = begin + std::chrono::milliseconds(m_timeLimitMs);
+        size_t iterations = 0;
+        MoveProposal proposal;
+        while (!queue.empty()) {
+            if (m_timeLimitMs > 0 && (++iterations & 1023) == 0 && Clock::now() > deadline) break;
+            uint32_t city = queue.front();
+            queue.pop_front();
+            active[city] = 0;
+
+            for (size_t m = 0; m < m_moves.size(); ++m) {
+                if (n < m_moves[m]->minTourSize()) continue;
+                ++m_stats[m].attempts;
+                proposal.cityCount = 0;
+                if (!m_moves[m]->findImprovement(city, context, proposal)) continue;
+
+                m_moves[m]->apply(proposal, context);
+                ++m_stats[m].accepted;
+                m_stats[m].gain -= proposal.delta;
+                for (uint8_t i = 0; i < proposal.cityCount; ++i) activate(proposal.cities[i]);
+                // Se melhorou, a cidade volta para a fila para nova tentativa
+                activate(city);
+                break;
+            }
+        }
+    }
+
+    const std::vector<MoveStats>& getStats() const { return m_stats; }
+
+    uint64_t getMovesApplied() const {
+        uint64_t total = 0;
+        for (const auto& stats : m_stats) total += stats.accepted;
+        return total;
+    }
+};
+
+#endif // LOCALSEARCH_H
@@ -0,0 +1,220 @@
+#ifndef LOCALSEARCHMOVES_H
+#define LOCALSEARCHMOVES_H
+
+#include <string>
+#include <cstdint>
+
+#include "algorithms/LocalSearch.h"
+
+/**
+ * @brief Movimento 2-opt: troca as arestas a-b e c-d por a-c e b-d
+ *
+ * Os dois sentidos são avaliados (b = sucessor ou predecessor de a); os
+ * vizinhos c de a são percorridos em ordem crescente de distância e a
+ * busca para quando a nova aresta a-c deixa de ser menor que a-b.
+ */
+class TwoOptMove : public LocalSearchMove {
+public:
+    bool findImprovement(uint32_t a, const LocalSearchContext& ctx,
+                         MoveProposal& proposal) const override {
+        const TourArray& tour = ctx.tour;
+        const uint32_t* neighbors = ctx.candidates.of(a);
+        for (int direction = 0; direction < 2; ++direction) {
+            bool forward = direction == 0;
+            uint32_t b = forward ? tour.next(a) : tour.prev(a);
+            double dab = ctx.d(a, b);
+
+            for (size_t i = 0; i < ctx.candidates.k(); ++i) {
+                uint32_t c = neighbors[i];
+                double dac = ctx.d(a, c);
+                if (dab - dac <= LocalSearch::EPSILON) break;   // vizinhos seguintes só pioram
+
+                uint32_t d = forward ? tour.next(c) : tour.prev(c);
+                if (c == b || d == a) continue;
+
+                double delta = dac + ctx.d(b, d) - dab - ctx.d(c, d);
+                if (delta < -LocalSearch::EPSILON) {
+                    proposal.delta = delta;
+                    proposal.cities[0] = a;
+                    proposal.cities[1] = b;
+                    proposal.cities[2] = c;
+                    proposal.cities[3] = d;
+                    proposal.cityCount = 4;
+                    proposal.variant = forward ? 0 : 1;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void apply(const MoveProposal& p, LocalSearchContext& ctx) const override {
+        // a-b ... c-d  =>  a-c ... b-d (b-a ... d-c no sentido inverso)
+        if (p.variant == 0) ctx.tour.reverse(p.cities[1], p.cities[2]);
+        else ctx.tour.reverse(p.cities[0], p.cities[3]);
+    }
+
+    std::string getName() const override { return "2-opt"; }
+};
+
+/**
+ * @brief Movimento Or-opt: realoca um segmento de 1 a maxSegment cidades
+ *
+ * Para cada segmento que começa ou termina na cidade ativa, o ganho de
+ * removê-lo (p-s1 ... s2-n vira p-n) é calculado uma vez; os pontos de
+ * inserção vêm das listas de candidatos das pontas do segmento, que pode
+ * ser reinserido na orientação original ou invertido. É um subconjunto
+ * dos movimentos 3-opt (segment insertion) avaliado em O(k) por segmento.
+ */
+class OrOptMove : public LocalSearchMove {
+private:
+    size_t m_maxSegment;
+    bool m_allowReversal;
+
+    // cities: p, n, s1, s2, after, next(after); variant: 1 = invertido
+    bool trySegment(uint32_t s1, uint32_t s2, size_t length, const LocalSearchContext& ctx,
+                    MoveProposal& proposal) const {
+        const TourArray& tour = ctx.tour;
+        uint32_t segment[8];
+        segment[0] = s1;
+        for (size_t i = 1; i < length; ++i) segment[i] = tour.next(segment[i - 1]);
+        auto inSegment = [&](uint32_t city) {
+            for (size_t i = 0; i < length; ++i) {
+                if (segment[i] == city) return true;
+            }
+            return false;
+        };
+
+        uint32_t p = tour.prev(s1), n = tour.next(s2);
+        double removeGain = ctx.d(p, s1) + ctx.d(s2, n) - ctx.d(p, n);
+        if (removeGain <= LocalSearch::EPSILON) return false;
+
+        for (int side = 0; side < 2; ++side) {
+            uint32_t end = side == 0 ? s1 : s2;
+            uint32_t other = side == 0 ? s2 : s1;
+            const uint32_t* neighbors = ctx.candidates.of(end);
+
+            for (size_t i = 0; i < ctx.candidates.k(); ++i) {
+                uint32_t c = neighbors[i];
+                double dc = ctx.d(end, c);
+                if (dc >= removeGain) break;
+                if (inSegment(c)) continue;
+
+                for (int direction = 0; direction < 2; ++direction) {
+                    bool forward = direction == 0;
+                    uint32_t e = forward ? tour.next(c) : tour.prev(c);
+                    if (inSegment(e)) continue;
+
+                    // Aresta de inserção (after, next(after)) no sentido do array
+                    uint32_t after = forward ? c : e;
+                    // Não invertido: after-s1 ... s2-next(after)
+                    bool reversed = (end == s1) != forward;
+                    if (reversed && length > 1 && !m_allowReversal) continue;
+
+                    double delta = dc + ctx.d(other, e) - ctx.d(c, e) - removeGain;
+                    if (delta < -LocalSearch::EPSILON) {
+                        proposal.delta = delta;
+                        proposal.cities[0] = p;
+                        proposal.cities[1] = n;
+                        proposal.cities[2] = s1;
+                        proposal.cities[3] = s2;
+                        proposal.cities[4] = after;
+                        proposal.cities[5] = forward ? e : c;
+                        proposal.cityCount = 6;
+                        proposal.variant = reversed ? 1 : 0;
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+public:
+    explicit OrOptMove(size_t maxSegment = 3, bool allowReversal = true)
+        : m_maxSegment(std::min<size_t>(std::max<size_t>(maxSegment, 1), 8)),
+          m_allowReversal(allowReversal) {}
+
+    bool findImprovement(uint32_t a, const LocalSearchContext& ctx,
+                         MoveProposal& proposal) const override {
+        const TourArray& tour = ctx.tour;
+        for (size_t length = 1; length <= m_maxSegment; ++length) {
+            if (tour.size() < length + 3) break;
+            // Segmento começando em a
+            uint32_t last = a;
+            for (size_t i = 1; i < length; ++i) last = tour.next(last);
+            if (trySegment(a, last, length, ctx, proposal)) return true;
+            if (length == 1) continue;
+            // Segmento terminando em a
+            uint32_t first = a;
+            for (size_t i = 1; i < length; ++i) first = tour.prev(first);
+            if (trySegment(first, a, length, ctx, proposal)) return true;
+        }
+        return false;
+    }
+
+    void apply(const MoveProposal& p, LocalSearchContext& ctx) const override {
+        ctx.tour.moveSegment(p.cities[2], p.cities[3], p.cities[4], p.variant == 1);
+    }
+
+    std::string getName() const override {
+        return m_allowReversal ? "Or-opt" : "Or-opt (no reversal)";
+    }
+};
+
+/**
+ * @brief Movimento or-2h: insere o vizinho c entre a e seu sucessor/predecessor
+ *
+ * Usa o mesmo critério de ganho do 2-opt (a-c mais curta que a-b), mas em
+ * vez de inverter o caminho move apenas a cidade c para dentro da aresta
+ * a-b. Complementa o Or-opt quando as listas de vizinhos não são
+ * simétricas (a está perto de c, mas c não tem a entre seus candidatos).
+ */
+class OrTwoHMove : public LocalSearchMove {
+public:
+    bool findImprovement(uint32_t a, const LocalSearchContext& ctx,
+                         MoveProposal& proposal) const override {
+        const TourArray& tour = ctx.tour;
+        const uint32_t* neighbors = ctx.candidates.of(a);
+        for (int direction = 0; direction < 2; ++direction) {
+            bool forward = direction == 0;
+            uint32_t b = forward ? tour.next(a) : tour.prev(a);
+            double dab = ctx.d(a, b);
+
+            for (size_t i = 0; i < ctx.candidates.k(); ++i) {
+                uint32_t c = neighbors[i];
+                double dac = ctx.d(a, c);
+                if (dab - dac <= LocalSearch::EPSILON) break;
+                if (c == b) continue;
+
+                uint32_t cp = tour.prev(c), cn = tour.next(c);
+                if (cp == a || cn == a) continue;
+
+                double delta = dac + ctx.d(c, b) - dab
+                             + ctx.d(cp, cn) - ctx.d(cp, c) - ctx.d(c, cn);
+                if (delta < -LocalSearch::EPSILON) {
+                    proposal.delta = delta;
+                    proposal.cities[0] = a;
+                    proposal.cities[1] = b;
+                    proposal.cities[2] = c;
+                    proposal.cities[3] = cp;
+                    proposal.cities[4] = cn;
+                    proposal.cityCount = 5;
+                    proposal.variant = forward ? 0 : 1;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void apply(const MoveProposal& p, LocalSearchContext& ctx) const override {
+        // Insere c após quem vem primeiro no sentido do array (a ou b)
+        uint32_t after = p.variant == 0 ? p.cities[0] : p.cities[1];
+        ctx.tour.moveSegment(p.cities[2], p.cities[2], after, false);
+    }
+
+    std::string getName() const override { return "or-2h"; }
+};
+
+#endif // LOCALSEARCHMOVES_H
@@ -0,0 +1,114 @@
+#ifndef LOCALSEARCHTSP_H
+#define LOCALSEARCHTSP_H
+
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "core/TSPAlgorithm.h"
+#include "core/CandidateLists.h"
+#include "core/TourArray.h"
+#include "algorithms/NearestNeighborTSP.h"
+#include "algorithms/LocalSearch.h"
+#include "algorithms/LocalSearchMoves.h"
+
+/**
+ * @brief Busca local com movimentos plugáveis sobre uma rota inicial
+ *
+ * Parte da rota de qualquer algoritmo construtivo (ou de uma Route já
+ * existente, via improve) e aplica os movimentos registrados até não
+ * haver melhoria. Sem movimentos explícitos usa 2-opt, Or-opt (segmentos
+ * de 1 a 3 cidades, com e sem inversão) e or-2h.
+ *
+ * Parâmetros (setParameters): neighbor_count, threads (listas de
+ * candidatos), time_limit_ms; os demais são repassados ao construtivo.
+ *
+ * Demonstra conceitos POO:
+ * - Herança: especialização de TSPAlgorithm e TSPImprover
+ * - Composição: contém o motor LocalSearch e o algoritmo construtivo
+ */
+class LocalSearchTSP : public TSPAlgorithm, public TSPImprover {
+private:
+    std::unique_ptr<TSPAlgorithm> m_initialSolver;
+    LocalSearch m_engine;
+    size_t m_neighborCount;
+    unsigned m_threads = 0;
+
+public:
+    explicit LocalSearchTSP(std::unique_ptr<TSPAlgorithm> initialSolver = std::make_unique<NearestNeighborTSP>(),
+                            size_t neighborCount = 8,
+                            std::vector<std::unique_ptr<LocalSearchMove>> moves = {})
+        : m_initialSolver(std::move(initialSolver)), m_neighborCount(neighborCount) {
+        if (moves.empty()) {
+            moves.push_back(std::make_unique<TwoOptMove>());
+            moves.push_back(std::make_unique<OrOptMove>());
+            moves.push_back(std::make_unique<OrTwoHMove>());
+        }
+        for (auto& move : moves) m_engine.addMove(std::move(move));
+    }
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        Route initial = m_initialSolver ? m_initialSolver->solve(graph)
+                                        : NearestNeighborTSP().solve(graph);
+        Route route = improve(initial);
+        // improve() registra só o próprio tempo; solve() inclui o construtivo
+        recordExecutionTime(start);
+        return route;
+    }
+
+    /**
+     * @brief Melhora uma rota existente (warm start)
+     * @param start Rota inicial, vinculada a um Graph
+     * @return Rota localmente ótima para os movimentos registrados
+     */
+    Route improve(const Route& start) override {
+        auto begin = Clock::now();
+        const Graph* graph = start.getGraph();
+        if (!graph) throw TSPException("Route is not bound to a graph");
+        if (!start.visitsEveryCity()) throw TSPException("Route must visit every city of its graph");
+
+        if (start.size() < 4) {
+            recordExecutionTime(begin);
+            return start;
+        }
+
+        const DistanceMatrix& dist = graph->getDistanceMatrix();
+        CandidateLists candidates(*graph, m_neighborCount, m_threads);
+        TourArray tour(start.getSequence());
+        m_engine.run(tour, dist, candidates);
+
+        Route result(*graph, tour.orderFrom(start[0]));
+        recordExecutionTime(begin);
+        return result;
+    }
+
+    void addMove(std::unique_ptr<LocalSearchMove> move) { m_engine.addMove(std::move(move)); }
+
+    void setNeighborCount(size_t k) { m_neighborCount = k; }
+    /// Limite de tempo em ms (0 = sem limite)
+    void setTimeLimit(long milliseconds) override { m_engine.setTimeLimit(milliseconds); }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "neighbor_count") m_neighborCount = static_cast<size_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+            else if (key == "time_limit_ms") setTimeLimit(static_cast<long>(value));
+        }
+        if (m_initialSolver) m_initialSolver->setParameters(params);
+    }
+
+    /**
+     * @brief Contadores por tipo de movimento da última execução
+     */
+    const std::vector<LocalSearch::MoveStats>& getMoveStats() const { return m_engine.getStats(); }
+    uint64_t getMovesApplied() const { return m_engine.getMovesApplied(); }
+
+    std::string getName() const override { return "Local Search"; }
+    std::string getDescription() const override {
+        return "Local search combining 2-opt, Or-opt and or-2h moves over k-nearest neighbor lists";
+    }
+};
+
+#endif // LOCALSEARCHTSP_H
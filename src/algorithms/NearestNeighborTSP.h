@@ -0,0 +1,111 @@
+#ifndef NEARESTNEIGHBORTSP_H
+#define NEARESTNEIGHBORTSP_H
+
+#include <vector>
+#include <limits>
+
+#include "core/TSPAlgorithm.h"
+#include "core/KDTree.h"
+
+/**
+ * @brief Algoritmo Nearest Neighbor para TSP
+ * 
+ * Implementação gulosa que sempre escolhe a cidade mais próxima.
+ * No modo KDTree a busca usa o índice espacial com remoção dos visitados
+ * (O(n log n) em média) e produz a mesma rota da varredura linear na
+ * métrica euclidiana. Nas métricas arredondadas da TSPLIB (EUC_2D,
+ * CEIL_2D, ATT) pontos a distâncias reais diferentes empatam depois do
+ * arredondamento, e o desempate da árvore (a menor distância real) difere
+ * do da varredura (o menor índice); por isso Mode::Auto só usa o índice
+ * com DistanceMetric::Euclidean.
+ */
+class NearestNeighborTSP : public TSPAlgorithm {
+public:
+    enum class Mode { Auto, Scan, KDTree };
+
+    /// Em Mode::Auto, a partir deste tamanho usa o índice espacial
+    static constexpr size_t AUTO_KDTREE_THRESHOLD = 2000;
+
+private:
+    Mode m_mode;
+
+    Route solveScan(const Graph& graph) {
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        Route route(graph);
+        route.reserve(graph.size());
+        std::vector<bool> visited(graph.size(), false);
+        
+        // Começar do primeiro ponto
+        size_t current = 0;
+        route.addPoint(static_cast<uint32_t>(current));
+        visited[current] = true;
+        
+        // Visitar pontos mais próximos
+        while (route.size() < graph.size()) {
+            double minDist = std::numeric_limits<double>::max();
+            size_t nextPoint = 0;
+            
+            for (size_t i = 0; i < graph.size(); ++i) {
+                if (!visited[i]) {
+                    double d = dist.at(current, i);
+                    if (d < minDist) {
+                        minDist = d;
+                        nextPoint = i;
+                    }
+                }
+            }
+            
+            current = nextPoint;
+            route.addPoint(static_cast<uint32_t>(current));
+            visited[current] = true;
+        }
+        
+        return route;
+    }
+
+    Route solveKDTree(const Graph& graph) {
+        ::KDTree index(graph);
+        Route route(graph);
+        route.reserve(graph.size());
+        
+        uint32_t current = 0;
+        route.addPoint(current);
+        index.remove(current);
+        
+        while (!index.empty()) {
+            current = index.nearest(graph.getX(current), graph.getY(current));
+            route.addPoint(current);
+            index.remove(current);
+        }
+        
+        return route;
+    }
+
+public:
+    explicit NearestNeighborTSP(Mode mode = Mode::Auto) : m_mode(mode) {}
+    
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+        
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        
+        // Auto só troca de caminho quando a rota é a mesma da varredura
+        bool useIndex = m_mode == Mode::KDTree ||
+            (m_mode == Mode::Auto && graph.size() >= AUTO_KDTREE_THRESHOLD &&
+             graph.getDistanceConfig().metric == DistanceMetric::Euclidean);
+        Route route = useIndex ? solveKDTree(graph) : solveScan(graph);
+        
+        recordExecutionTime(start);
+        return route;
+    }
+    
+    void setMode(Mode mode) { m_mode = mode; }
+    Mode getMode() const { return m_mode; }
+    
+    std::string getName() const override { return "Nearest Neighbor"; }
+    std::string getDescription() const override { 
+        return "Greedy algorithm that selects nearest unvisited city"; 
+    }
+};
+
+#endif // NEARESTNEIGHBORTSP_H
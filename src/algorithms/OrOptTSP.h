@@ -0,0 +1,36 @@
+#ifndef OROPTTSP_H
+#define OROPTTSP_H
+
+#include <vector>
+#include <memory>
+
+#include "algorithms/LocalSearchTSP.h"
+
+/**
+ * @brief Otimização local Or-opt com listas de vizinhos e don't-look bits
+ *
+ * Caso particular de LocalSearchTSP com apenas o movimento Or-opt:
+ * segmentos de 1 a 3 cidades são realocados, com ou sem inversão, entre
+ * cidades próximas das suas pontas. Costuma ser aplicado depois do 2-opt
+ * (ver ChainTSP), corrigindo cidades isoladas que o 2-opt não alcança.
+ */
+class OrOptTSP : public LocalSearchTSP {
+private:
+    static std::vector<std::unique_ptr<LocalSearchMove>> orOptOnly() {
+        std::vector<std::unique_ptr<LocalSearchMove>> moves;
+        moves.push_back(std::make_unique<OrOptMove>());
+        return moves;
+    }
+
+public:
+    explicit OrOptTSP(std::unique_ptr<TSPAlgorithm> initialSolver = std::make_unique<NearestNeighborTSP>(),
+                      size_t neighborCount = 8)
+        : LocalSearchTSP(std::move(initialSolver), neighborCount, orOptOnly()) {}
+
+    std::string getName() const override { return "Or-Opt"; }
+    std::string getDescription() const override {
+        return "Local search relocating segments of 1 to 3 cities over k-nearest neighbor lists";
+    }
+};
+
+#endif // OROPTTSP_H
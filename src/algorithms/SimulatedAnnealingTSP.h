@@ -0,0 +1,276 @@
+#ifndef SIMULATEDANNEALINGTSP_H
+#define SIMULATEDANNEALINGTSP_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <unordered_map>
+
+#include "core/TSPAlgorithm.h"
+#include "core/CandidateLists.h"
+#include "core/TourArray.h"
+#include "core/ThreadPool.h"
+#include "core/FastRandom.h"
+#include "algorithms/NearestNeighborTSP.h"
+
+/**
+ * @brief Simulated annealing com parallel tempering
+ *
+ * Mantém uma réplica da rota por thread, cada uma a uma temperatura fixa
+ * de uma escala geométrica (t_max a t_min, relativas ao comprimento médio
+ * das arestas da rota inicial). Em cada época as réplicas executam
+ * epoch_moves movimentos em paralelo; depois réplicas de temperaturas
+ * vizinhas trocam de rota com a probabilidade de Metropolis, o que deixa
+ * as boas rotas descerem para as temperaturas baixas.
+ *
+ * Movimentos: 2-opt e Or-opt (segmentos de 1 a 3 cidades) guiados pelas
+ * listas de candidatos, com delta em O(1). A execução para ao fim do
+ * orçamento de tempo (time_limit_ms, obrigatório e positivo); a rota
+ * inicial vem de qualquer algoritmo construtivo ou de uma Route existente
+ * (improve), então o annealing também serve de etapa de melhoria numa
+ * ChainTSP.
+ *
+ * Parâmetros (setParameters): time_limit_ms, replicas, t_max, t_min,
+ * epoch_moves, or_opt_probability, neighbor_count, seed, threads.
+ */
+class SimulatedAnnealingTSP : public TSPAlgorithm, public TSPImprover {
+private:
+    std::unique_ptr<TSPAlgorithm> m_initialSolver;
+    long m_timeLimitMs;
+    unsigned m_replicas;
+    double m_tMax;
+    double m_tMin;
+    size_t m_epochMoves;
+    double m_orOptProbability;
+    size_t m_neighborCount;
+    uint64_t m_seed;
+    unsigned m_threads;
+
+    uint64_t m_movesTried;
+    uint64_t m_movesAccepted;
+    uint64_t m_swapsTried;
+    uint64_t m_swapsAccepted;
+    double m_movesPerSecond;
+
+    struct Replica {
+        TourArray tour;
+        double length = 0.0;
+        double temperature = 0.0;
+        uint64_t tried = 0;
+        uint64_t accepted = 0;
+    };
+
+    struct Context {
+        const DistanceMatrix& dist;
+        const CandidateLists& candidates;
+        double d(uint32_t a, uint32_t b) const { return dist.at(a, b); }
+    };
+
+    static bool acceptDelta(double delta, double temperature, FastRandom& rng) {
+        if (delta <= 0.0) return true;
+        return rng.uniformReal() < std::exp(-delta / temperature);
+    }
+
+    static bool tryTwoOpt(Replica& r, const Context& ctx, FastRandom& rng) {
+        TourArray& tour = r.tour;
+        uint32_t a = rng.uniform(static_cast<uint32_t>(tour.size()));
+        uint32_t c = ctx.candidates.of(a)[rng.uniform(static_cast<uint32_t>(ctx.candidates.k()))];
+        bool forward = rng.next() & 1;
+        uint32_t b = forward ? tour.next(a) : tour.prev(a);
+        uint32_t d = forward ? tour.next(c) : tour.prev(c);
+        if (c == b || d == a) return false;
+
+        double delta = ctx.d(a, c) + ctx.d(b, d) - ctx.d(a, b) - ctx.d(c, d);
+        if (!acceptDelta(delta, r.temperature, rng)) return false;
+        tour.twoOptMove(a, b, c, d);
+        r.length += delta;
+        return true;
+    }
+
+    static bool tryOrOpt(Replica& r, const Context& ctx, FastRandom& rng) {
+        TourArray& tour = r.tour;
+        size_t length = 1 + rng.uniform(3);
+        if (tour.size() < length + 3) return false;
+
+        uint32_t segment[3];
+        segment[0] = rng.uniform(static_cast<uint32_t>(tour.size()));
+        for (size_t i = 1; i < length; ++i) segment[i] = tour.next(segment[i - 1]);
+        uint32_t s1 = segment[0], s2 = segment[length - 1];
+        auto inSegment = [&](uint32_t city) {
+            return std::find(segment, segment + length, city) != segment + length;
+        };
+
+        bool fromFirst = rng.next() & 1;
+        uint32_t end = fromFirst ? s1 : s2;
+        uint32_t other = fromFirst ? s2 : s1;
+        uint32_t c = ctx.candidates.of(end)[rng.uniform(static_cast<uint32_t>(ctx.candidates.k()))];
+        bool forward = rng.next() & 1;
+        uint32_t e = forward ? tour.next(c) : tour.prev(c);
+        if (inSegment(c) || inSegment(e)) return false;
+
+        uint32_t p = tour.prev(s1), n = tour.next(s2);
+        double delta = ctx.d(end, c) + ctx.d(other, e) - ctx.d(c, e)
+                     - ctx.d(p, s1) - ctx.d(s2, n) + ctx.d(p, n);
+        if (!acceptDelta(delta, r.temperature, rng)) return false;
+
+        // Mesmo mapeamento de OrOptMove: end fica ligado a c
+        uint32_t after = forward ? c : e;
+        bool reversed = (end == s1) != forward;
+        tour.moveSegment(s1, s2, after, reversed);
+        r.length += delta;
+        return true;
+    }
+
+    void checkParameters() const {
+        // Sem orçamento o laço nem começa e a rota inicial volta inalterada
+        if (m_timeLimitMs <= 0) throw TSPException("Invalid parameter: time_limit_ms");
+        if (m_tMin <= 0.0 || m_tMax < m_tMin) throw TSPException("Invalid parameter: temperature range");
+    }
+
+public:
+    explicit SimulatedAnnealingTSP(std::unique_ptr<TSPAlgorithm> initialSolver = std::make_unique<NearestNeighborTSP>(),
+                                   long timeLimitMs = 1000)
+        : m_initialSolver(std::move(initialSolver)), m_timeLimitMs(timeLimitMs), m_replicas(0),
+          m_tMax(0.5), m_tMin(0.002), m_epochMoves(20000), m_orOptProbability(0.3),
+          m_neighborCount(8), m_seed(12345), m_threads(0),
+          m_movesTried(0), m_movesAccepted(0), m_swapsTried(0), m_swapsAccepted(0),
+          m_movesPerSecond(0.0) {}
+
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        checkParameters();
+        Route initial = m_initialSolver ? m_initialSolver->solve(graph)
+                                        : NearestNeighborTSP().solve(graph);
+        Route route = improve(initial);
+        // improve() registra só o próprio tempo; solve() inclui o construtivo
+        recordExecutionTime(start);
+        return route;
+    }
+
+    /**
+     * @brief Melhora uma rota existente (warm start)
+     * @param start Rota inicial, vinculada a um Graph
+     */
+    Route improve(const Route& start) override {
+        auto begin = Clock::now();
+        const Graph* graph = start.getGraph();
+        if (!graph) throw TSPException("Route is not bound to a graph");
+        if (!start.visitsEveryCity()) throw TSPException("Route must visit every city of its graph");
+        checkParameters();
+        m_movesTried = m_movesAccepted = m_swapsTried = m_swapsAccepted = 0;
+        m_movesPerSecond = 0.0;
+
+        if (start.size() < 5) {
+            recordExecutionTime(begin);
+            return start;
+        }
+
+        const size_t n = start.size();
+        const DistanceMatrix& dist = graph->getDistanceMatrix();
+        CandidateLists candidates(*graph, m_neighborCount, m_threads);
+        Context ctx{dist, candidates};
+
+        // threads limita os participantes; as réplicas excedentes são divididas entre eles
+        ThreadPool pool(m_threads ? m_threads : m_replicas);
+        const size_t replicaCount = std::max<size_t>(2, m_replicas ? m_replicas : pool.size());
+
+        // Escala geométrica de temperaturas, relativa à aresta média
+        double initialLength = start.getTotalDistance();
+        double scale = initialLength / n;
+        std::vector<Replica> replicas(replicaCount);
+        for (size_t r = 0; r < replicaCount; ++r) {
+            double t = replicaCount == 1 ? 0.0 : double(r) / double(replicaCount - 1);
+            replicas[r].tour.assign(start.getSequence());
+            replicas[r].length = initialLength;
+            replicas[r].temperature = scale * m_tMin * std::pow(m_tMax / m_tMin, t);
+        }
+
+        std::vector<uint32_t> best = start.getSequence();
+        double bestLength = initialLength;
+
+        auto deadline = begin + std::chrono::milliseconds(m_timeLimitMs);
+        FastRandom swapRng(FastRandom::mix(m_seed, 0x5A9, 0));
+        for (uint64_t epoch = 1; Clock::now() < deadline; ++epoch) {
+            pool.parallelFor(replicaCount, [&](size_t index, unsigned) {
+                Replica& replica = replicas[index];
+                FastRandom rng(FastRandom::mix(m_seed, epoch, index));
+                for (size_t m = 0; m < m_epochMoves; ++m) {
+                    bool moved = rng.uniformReal() < m_orOptProbability
+                               ? tryOrOpt(replica, ctx, rng) : tryTwoOpt(replica, ctx, rng);
+                    ++replica.tried;
+                    if (moved) ++replica.accepted;
+                }
+            });
+
+            for (const auto& replica : replicas) {
+                if (replica.length < bestLength - 1e-9) {
+                    bestLength = replica.length;
+                    best = replica.tour.order();
+                }
+            }
+
+            // Trocas entre temperaturas vizinhas (critério de Metropolis)
+            for (size_t r = epoch % 2; r + 1 < replicaCount; r += 2) {
+                Replica& cold = replicas[r];
+                Replica& hot = replicas[r + 1];
+                double exponent = (cold.length - hot.length) *
+                                  (1.0 / cold.temperature - 1.0 / hot.temperature);
+                ++m_swapsTried;
+                if (exponent >= 0.0 || swapRng.uniformReal() < std::exp(exponent)) {
+                    std::swap(cold.tour, hot.tour);
+                    std::swap(cold.length, hot.length);
+                    ++m_swapsAccepted;
+                }
+            }
+        }
+
+        for (const auto& replica : replicas) {
+            m_movesTried += replica.tried;
+            m_movesAccepted += replica.accepted;
+        }
+        double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+        if (seconds > 0.0) m_movesPerSecond = m_movesTried / seconds;
+
+        TourArray result(best);
+        Route route(*graph, result.orderFrom(start[0]));
+        recordExecutionTime(begin);
+        return route.getTotalDistance() <= initialLength ? route : start;
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "time_limit_ms") m_timeLimitMs = static_cast<long>(value);
+            else if (key == "replicas") m_replicas = static_cast<unsigned>(value);
+            else if (key == "t_max") m_tMax = value;
+            else if (key == "t_min") m_tMin = value;
+            else if (key == "epoch_moves") m_epochMoves = static_cast<size_t>(value);
+            else if (key == "or_opt_probability") m_orOptProbability = value;
+            // Os movimentos sorteiam um candidato: é preciso ao menos um
+            else if (key == "neighbor_count") m_neighborCount = std::max<size_t>(1, static_cast<size_t>(value));
+            else if (key == "seed") m_seed = static_cast<uint64_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+        }
+    }
+
+    /// Limite de tempo em ms
+    void setTimeLimit(long milliseconds) override { m_timeLimitMs = milliseconds; }
+
+    uint64_t getMovesTried() const { return m_movesTried; }
+    uint64_t getMovesAccepted() const { return m_movesAccepted; }
+    uint64_t getSwapsTried() const { return m_swapsTried; }
+    uint64_t getSwapsAccepted() const { return m_swapsAccepted; }
+    /// Movimentos avaliados por segundo, somando as réplicas
+    double getMovesPerSecond() const { return m_movesPerSecond; }
+
+    std::string getName() const override { return "Simulated Annealing"; }
+    std::string getDescription() const override {
+        return "Parallel tempering over 2-opt and Or-opt moves with a wall-clock budget";
+    }
+};
+
+#endif // SIMULATEDANNEALINGTSP_H
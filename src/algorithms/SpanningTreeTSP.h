@@ -0,0 +1,259 @@
+#ifndef SPANNINGTREETSP_H
+#define SPANNINGTREETSP_H
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+#include "core/TSPAlgorithm.h"
+#include "core/MinimumSpanningTree.h"
+#include "core/KDTree.h"
+#include "core/RadixSort.h"
+#include "core/ThreadPool.h"
+
+/**
+ * @brief Base dos construtivos baseados na árvore geradora mínima
+ *
+ * A árvore vem de MinimumSpanningTree (Kruskal sobre os k vizinhos) e fica
+ * disponível depois de solve() em getTree(), por exemplo para comparar a
+ * rota com o limite inferior getTree().getWeight().
+ *
+ * Demonstra conceitos POO:
+ * - Template Method: solve() constrói a árvore, a subclasse monta a rota
+ * - Herança e polimorfismo
+ */
+class SpanningTreeTSP : public TSPAlgorithm {
+protected:
+    size_t m_neighborCount;
+    unsigned m_threads;
+    MinimumSpanningTree m_tree;
+
+    SpanningTreeTSP(size_t neighborCount, unsigned threads)
+        : m_neighborCount(neighborCount), m_threads(threads) {}
+
+    /// Ordem de visita das cidades, começando na cidade 0
+    virtual std::vector<uint32_t> buildTour(const Graph& graph) = 0;
+
+public:
+    Route solve(const Graph& graph) override {
+        auto start = Clock::now();
+
+        if (graph.size() < 2) throw TSPException("Need at least 2 points");
+        m_tree.build(graph, m_neighborCount, m_threads);
+        Route route(graph, buildTour(graph));
+
+        recordExecutionTime(start);
+        return route;
+    }
+
+    void setParameters(const std::unordered_map<std::string, double>& params) override {
+        for (const auto& [key, value] : params) {
+            if (key == "neighbor_count") m_neighborCount = static_cast<size_t>(value);
+            else if (key == "threads") m_threads = static_cast<unsigned>(value);
+        }
+    }
+
+    /// Árvore da última execução
+    const MinimumSpanningTree& getTree() const { return m_tree; }
+};
+
+/**
+ * @brief Árvore dupla: pré-ordem da árvore geradora mínima
+ *
+ * Duplicar as arestas da árvore dá um circuito euleriano; pular as cidades
+ * repetidas equivale a visitá-las em pré-ordem. Pela desigualdade
+ * triangular a rota tem no máximo o dobro do ótimo.
+ */
+class DoubleTreeTSP : public SpanningTreeTSP {
+protected:
+    std::vector<uint32_t> buildTour(const Graph&) override {
+        return m_tree.preorder(0);
+    }
+
+public:
+    explicit DoubleTreeTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : SpanningTreeTSP(neighborCount, threads) {}
+
+    std::string getName() const override { return "Double Tree"; }
+    std::string getDescription() const override {
+        return "Shortcuts a preorder walk of the Euclidean minimum spanning tree";
+    }
+};
+
+/**
+ * @brief Christofides com emparelhamento guloso dos vértices de grau ímpar
+ *
+ * Os vértices de grau ímpar da árvore são emparelhados de forma gulosa:
+ * arestas entre os vizinhos ímpares mais próximos (KDTree só com os
+ * ímpares) em ordem crescente de comprimento, e as sobras pelo ímpar
+ * livre mais próximo. Com GEO ou matriz explícita os vizinhos vêm de
+ * varreduras da matriz de distâncias (O(m²) nos m ímpares). Árvore +
+ * emparelhamento formam um multigrafo euleriano; o circuito (Hierholzer)
+ * com atalhos dá a rota. O
+ * emparelhamento guloso troca a garantia de 1.5x do emparelhamento
+ * perfeito mínimo por custo O(n log n).
+ */
+class ChristofidesTSP : public SpanningTreeTSP {
+private:
+    static constexpr size_t MATCHING_NEIGHBORS = 5;
+
+    /// Pares (a, b) em índices do grafo
+    std::vector<std::pair<uint32_t, uint32_t>> greedyMatching(const Graph& graph,
+                                                              const std::vector<uint32_t>& odd) const {
+        const size_t m = odd.size();
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        // GEO e matriz explícita: a distância das coordenadas não ordena os vizinhos
+        const bool spatial = followsCoordinates(graph.getDistanceConfig().metric);
+        std::vector<double> xs, ys;
+        KDTree index;
+        if (spatial) {
+            xs.resize(m);
+            ys.resize(m);
+            for (size_t i = 0; i < m; ++i) {
+                xs[i] = graph.getX(odd[i]);
+                ys[i] = graph.getY(odd[i]);
+            }
+            index.build(xs.data(), ys.data(), m);
+        }
+
+        // Arestas candidatas entre ímpares, em índices locais
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        std::vector<float> lengths;
+        edges.reserve(m * MATCHING_NEIGHBORS);
+        std::vector<uint32_t> others;
+        for (uint32_t i = 0; i < m; ++i) {
+            if (spatial) {
+                for (const auto& neighbor : index.kNearest(i, MATCHING_NEIGHBORS)) {
+                    if (neighbor.second < i) continue;
+                    edges.push_back({i, neighbor.second});
+                    lengths.push_back(static_cast<float>(neighbor.first));
+                }
+                continue;
+            }
+            // Varredura da linha da matriz: O(m) por ímpar
+            others.clear();
+            for (uint32_t j = 0; j < m; ++j) {
+                if (j != i) others.push_back(j);
+            }
+            size_t count = std::min(MATCHING_NEIGHBORS, others.size());
+            std::partial_sort(others.begin(), others.begin() + count, others.end(), [&](uint32_t a, uint32_t b) {
+                return dist.at(odd[i], odd[a]) < dist.at(odd[i], odd[b]);
+            });
+            for (size_t t = 0; t < count; ++t) {
+                if (others[t] < i) continue;
+                edges.push_back({i, others[t]});
+                lengths.push_back(static_cast<float>(dist.at(odd[i], odd[others[t]])));
+            }
+        }
+
+        ThreadPool pool(m_threads);
+        RadixSort::Items items(edges.size());
+        for (size_t e = 0; e < edges.size(); ++e) {
+            uint32_t bits;
+            std::memcpy(&bits, &lengths[e], sizeof(bits));
+            items[e] = RadixSort::pack(bits, static_cast<uint32_t>(e));
+        }
+        RadixSort::sortByKey(items, pool);
+
+        std::vector<std::pair<uint32_t, uint32_t>> matching;
+        matching.reserve(m / 2);
+        std::vector<uint8_t> matched(m, 0);
+        auto match = [&](uint32_t a, uint32_t b) {
+            matched[a] = matched[b] = 1;
+            if (spatial) {
+                index.remove(a);
+                index.remove(b);
+            }
+            matching.push_back({odd[a], odd[b]});
+        };
+        for (uint64_t item : items) {
+            auto [a, b] = edges[RadixSort::valueOf(item)];
+            if (!matched[a] && !matched[b]) match(a, b);
+        }
+
+        for (uint32_t a = 0; a < m; ++a) {
+            if (matched[a]) continue;
+            uint32_t b = a;
+            if (spatial) {
+                index.remove(a);
+                b = index.nearest(xs[a], ys[a]);
+            } else {
+                for (uint32_t c = a + 1; c < m; ++c) {
+                    if (!matched[c] && (b == a || dist.at(odd[a], odd[c]) < dist.at(odd[a], odd[b]))) b = c;
+                }
+            }
+            match(a, b);
+        }
+        return matching;
+    }
+
+protected:
+    std::vector<uint32_t> buildTour(const Graph& graph) override {
+        const uint32_t n = static_cast<uint32_t>(graph.size());
+
+        std::vector<uint32_t> odd;
+        for (uint32_t v = 0; v < n; ++v) {
+            if (m_tree.degree(v) % 2 == 1) odd.push_back(v);
+        }
+        auto matching = greedyMatching(graph, odd);
+
+        // Multigrafo árvore + emparelhamento em CSR, com id de aresta
+        std::vector<std::pair<uint32_t, uint32_t>> edges;
+        edges.reserve(m_tree.edges().size() + matching.size());
+        for (const auto& edge : m_tree.edges()) edges.push_back({edge.a, edge.b});
+        edges.insert(edges.end(), matching.begin(), matching.end());
+
+        std::vector<uint32_t> offset(n + 1, 0);
+        for (const auto& [a, b] : edges) {
+            ++offset[a + 1];
+            ++offset[b + 1];
+        }
+        for (uint32_t v = 0; v < n; ++v) offset[v + 1] += offset[v];
+        std::vector<uint32_t> incident(2 * edges.size());
+        std::vector<uint32_t> fill(offset.begin(), offset.end() - 1);
+        for (uint32_t e = 0; e < edges.size(); ++e) {
+            incident[fill[edges[e].first]++] = e;
+            incident[fill[edges[e].second]++] = e;
+        }
+
+        // Circuito euleriano (Hierholzer iterativo) com atalhos
+        std::vector<uint8_t> used(edges.size(), 0), visited(n, 0);
+        std::vector<uint32_t> cursor(offset.begin(), offset.end() - 1);
+        std::vector<uint32_t> stack{0};
+        std::vector<uint32_t> tour;
+        tour.reserve(n);
+        while (!stack.empty()) {
+            uint32_t v = stack.back();
+            while (cursor[v] < offset[v + 1] && used[incident[cursor[v]]]) ++cursor[v];
+            if (cursor[v] == offset[v + 1]) {
+                stack.pop_back();
+                if (!visited[v]) {
+                    visited[v] = 1;
+                    tour.push_back(v);
+                }
+                continue;
+            }
+            uint32_t e = incident[cursor[v]++];
+            used[e] = 1;
+            stack.push_back(edges[e].first == v ? edges[e].second : edges[e].first);
+        }
+
+        // Os vértices saem da pilha na ordem inversa do circuito, que
+        // termina (e portanto começa a sair) na cidade 0
+        return tour;
+    }
+
+public:
+    explicit ChristofidesTSP(size_t neighborCount = 10, unsigned threads = 0)
+        : SpanningTreeTSP(neighborCount, threads) {}
+
+    std::string getName() const override { return "Christofides"; }
+    std::string getDescription() const override {
+        return "Minimum spanning tree plus greedy odd-vertex matching, Euler tour shortcut";
+    }
+};
+
+#endif // SPANNINGTREETSP_H
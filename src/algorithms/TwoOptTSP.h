@@ -0,0 +1,37 @@
+#ifndef TWOOPTTSP_H
+#define TWOOPTTSP_H
+
+#include <vector>
+#include <memory>
+
+#include "algorithms/LocalSearchTSP.h"
+
+/**
+ * @brief Otimização local 2-Opt com listas de vizinhos e don't-look bits
+ *
+ * Caso particular de LocalSearchTSP com apenas o movimento 2-opt. Os
+ * movimentos candidatos são restritos aos k vizinhos mais próximos de
+ * cada cidade, o ganho de cada movimento é avaliado em O(1) e cidades cuja
+ * vizinhança não mudou são puladas (don't-look bits, mantidos como fila
+ * de cidades ativas).
+ */
+class TwoOptTSP : public LocalSearchTSP {
+private:
+    static std::vector<std::unique_ptr<LocalSearchMove>> twoOptOnly() {
+        std::vector<std::unique_ptr<LocalSearchMove>> moves;
+        moves.push_back(std::make_unique<TwoOptMove>());
+        return moves;
+    }
+
+public:
+    explicit TwoOptTSP(std::unique_ptr<TSPAlgorithm> initialSolver = std::make_unique<NearestNeighborTSP>(),
+                       size_t neighborCount = 8)
+        : LocalSearchTSP(std::move(initialSolver), neighborCount, twoOptOnly()) {}
+
+    std::string getName() const override { return "2-Opt"; }
+    std::string getDescription() const override {
+        return "Local search with 2-opt moves over k-nearest neighbor lists";
+    }
+};
+
+#endif // TWOOPTTSP_H
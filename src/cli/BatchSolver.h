@@ -0,0 +1,316 @@
+#ifndef BATCHSOLVER_H
+#define BATCHSOLVER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <ostream>
+#include <set>
+#include <algorithm>
+#include <filesystem>
+
+#include "core/Graph.h"
+#include "core/Route.h"
+#include "core/ThreadPool.h"
+#include "core/TSPException.h"
+#include "algorithms/ChainTSP.h"
+#include "io/InstanceReader.h"
+#include "io/OutputBuffer.h"
+#include "io/TourFile.h"
+#include "cli/CommandLine.h"
+
+/**
+ * @brief Resolve várias instâncias em paralelo com a mesma cadeia de algoritmos
+ *
+ * As instâncias independentes são distribuídas por um ThreadPool de
+ * options.jobs participantes (uma instância por vez por participante, as
+ * maiores primeiro), e os núcleos que sobram são divididos entre elas
+ * pelo parâmetro "threads" dos algoritmos. Cada instância tem seu próprio
+ * Graph e sua própria cadeia; erros de uma instância (arquivo inválido,
+ * memória) entram no resumo e não interrompem as demais.
+ *
+ * Cada resultado é acrescentado ao resumo CSV assim que termina (com
+ * flush), então um lote interrompido preserva o que já foi resolvido.
+ * Colunas: instance, name, status (ok/error), cities, length, load_ms,
+ * solve_ms, stages ("nome:comprimento:ms" por etapa, separadas por ';',
+ * ou "nome:skipped" sem tempo restante) e message (o erro).
+ *
+ * Com --tours, a rota de cada instância vai para DIR/<arquivo>.<formato>,
+ * mantendo a extensão da entrada (x.tsp → x.tsp.tour), para que x.tsp e
+ * x.csv não disputem o mesmo arquivo; arquivos de mesmo nome em
+ * diretórios diferentes recebem um sufixo (x-2.tsp.tour).
+ */
+class BatchSolver {
+public:
+    struct Instance {
+        std::string path;
+        uintmax_t bytes = 0;
+        std::string tourName;   ///< Nome do arquivo de rota, sem a extensão do formato
+    };
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Outcome {
+        bool ok = false;
+        std::string name;
+        size_t cities = 0;
+        double length = 0.0;
+        double loadMs = 0.0;
+        double solveMs = 0.0;
+        std::vector<ChainTSP::StageResult> stages;
+        std::string error;
+    };
+
+    BatchOptions m_options;
+    std::vector<std::string> m_stageNames;
+    std::mutex m_mutex;
+    std::unique_ptr<OutputBuffer> m_summary;
+    size_t m_finished = 0;
+    size_t m_failed = 0;
+
+    static double elapsedMs(Clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    }
+
+    static void addInstance(const std::filesystem::path& path, std::vector<Instance>& instances) {
+        std::error_code error;
+        uintmax_t bytes = std::filesystem::file_size(path, error);
+        instances.push_back({path.string(), error ? 0 : bytes, {}});
+    }
+
+    static void addDirectory(const std::filesystem::path& directory, std::vector<Instance>& instances) {
+        std::vector<std::filesystem::path> files;
+        for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+            if (entry.is_regular_file() && InstanceReader::recognizes(entry.path().string())) {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+        for (const auto& file : files) addInstance(file, instances);
+    }
+
+    static void addManifest(const std::filesystem::path& manifest, std::vector<Instance>& instances) {
+        std::ifstream in(manifest);
+        if (!in) throw TSPException("Cannot open file: " + manifest.string());
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') continue;
+            size_t last = line.find_last_not_of(" \t\r");
+            std::filesystem::path entry = line.substr(first, last - first + 1);
+            if (entry.is_relative()) entry = manifest.parent_path() / entry;
+            if (std::filesystem::is_directory(entry)) {
+                addDirectory(entry, instances);
+            } else {
+                addInstance(entry, instances);
+            }
+        }
+    }
+
+    std::string tourPath(const Instance& instance) const {
+        return (std::filesystem::path(m_options.toursDir) / (instance.tourName + "." + m_options.tourFormat)).string();
+    }
+
+    Outcome solveOne(const Instance& instance, unsigned threads) const {
+        Outcome outcome;
+        try {
+            auto start = Clock::now();
+            Graph graph;
+            outcome.name = InstanceReader::load(instance.path, graph, nullptr, threads);
+            outcome.cities = graph.size();
+            outcome.loadMs = elapsedMs(start);
+            // A matriz (512 < n <= 5000) também é construída com a fatia de núcleos da instância
+            DistanceMatrix::Config config = graph.getDistanceConfig();
+            config.threads = threads;
+            graph.setDistanceConfig(config);
+
+            start = Clock::now();
+            std::unique_ptr<ChainTSP> chain = CommandLine::makeChain(m_options.chain);
+            chain->setParameters({{"threads", static_cast<double>(threads)},
+                                  {"time_limit_ms", static_cast<double>(m_options.timeLimitMs)}});
+            Route route = chain->solve(graph);
+            outcome.solveMs = elapsedMs(start);
+            outcome.length = route.getTotalDistance();
+            outcome.stages = chain->getStages();
+
+            if (!m_options.toursDir.empty()) TourFile::write(tourPath(instance), route, outcome.name);
+            outcome.ok = true;
+        } catch (const std::exception& e) {
+            outcome.error = e.what();
+        }
+        return outcome;
+    }
+
+    void writeSummaryHeader() {
+        m_summary->put("instance,name,status,cities,length,load_ms,solve_ms,stages,message\n");
+        m_summary->flush();
+    }
+
+    void writeSummaryRow(const Instance& instance, const Outcome& outcome) {
+        OutputBuffer& out = *m_summary;
+        out.putCsvField(instance.path);
+        out.put(',');
+        out.putCsvField(outcome.name);
+        out.put(outcome.ok ? ",ok," : ",error,");
+        out.putUnsigned(outcome.cities);
+        out.put(',');
+        if (outcome.ok) out.putDouble(outcome.length);
+        out.put(',');
+        out.putDouble(outcome.loadMs, 1);
+        out.put(',');
+        if (outcome.ok) out.putDouble(outcome.solveMs, 1);
+        out.put(',');
+        for (size_t s = 0; s < outcome.stages.size(); ++s) {
+            const ChainTSP::StageResult& stage = outcome.stages[s];
+            if (s > 0) out.put(';');
+            out.put(s < m_stageNames.size() ? m_stageNames[s] : stage.name);
+            if (stage.skipped) {
+                out.put(":skipped");
+                continue;
+            }
+            out.put(':');
+            out.putDouble(stage.length);
+            out.put(':');
+            out.putSigned(stage.milliseconds);
+        }
+        out.put(',');
+        out.putCsvField(outcome.error);
+        out.put('\n');
+        out.flush();
+    }
+
+    void report(const Instance& instance, const Outcome& outcome, size_t total, std::ostream& log) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_finished;
+        if (!outcome.ok) ++m_failed;
+        log << (outcome.ok ? "✅ [" : "❌ [") << m_finished << "/" << total << "] ";
+        if (outcome.ok) {
+            log << outcome.name << " (" << outcome.cities << " cidades): " << outcome.length
+                << " em " << outcome.solveMs << "ms" << std::endl;
+        } else {
+            log << instance.path << ": " << outcome.error << std::endl;
+        }
+
+        if (!m_summary) return;
+        try {
+            writeSummaryRow(instance, outcome);
+        } catch (const TSPException& e) {
+            log << "❌ " << e.what() << " (resumo desativado)" << std::endl;
+            m_summary.reset();
+        }
+    }
+
+public:
+    explicit BatchSolver(BatchOptions options)
+        : m_options(std::move(options)), m_stageNames(CommandLine::chainNames(m_options.chain)) {}
+
+    /**
+     * @brief Expande as entradas em instâncias
+     *
+     * Diretórios contribuem seus arquivos de instância (sem subdiretórios),
+     * em ordem alfabética; arquivos com extensão de instância entram
+     * diretamente; qualquer outro arquivo é lido como manifesto. Cada
+     * instância recebe um tourName único (ver a descrição da classe).
+     * @throws TSPException se uma entrada não existir ou se o mesmo arquivo
+     *         aparecer mais de uma vez
+     */
+    static std::vector<Instance> collect(const std::vector<std::string>& inputs) {
+        std::vector<Instance> instances;
+        for (const std::string& input : inputs) {
+            std::filesystem::path path(input);
+            if (std::filesystem::is_directory(path)) {
+                addDirectory(path, instances);
+            } else if (!std::filesystem::exists(path)) {
+                throw TSPException("Cannot open file: " + input);
+            } else if (InstanceReader::recognizes(input)) {
+                addInstance(path, instances);
+            } else {
+                addManifest(path, instances);
+            }
+        }
+
+        std::set<std::string> files, names;
+        for (Instance& instance : instances) {
+            std::error_code error;
+            std::filesystem::path file = std::filesystem::weakly_canonical(instance.path, error);
+            if (!files.insert(error ? instance.path : file.string()).second) {
+                throw TSPException("Duplicate instance: " + instance.path);
+            }
+            std::filesystem::path source(instance.path);
+            std::string name = source.filename().string();
+            for (size_t copy = 2; !names.insert(name).second; ++copy) {
+                name = source.stem().string() + "-" + std::to_string(copy) + source.extension().string();
+            }
+            instance.tourName = name;
+        }
+        return instances;
+    }
+
+    /**
+     * @brief Resolve todas as instâncias, escrevendo o progresso em log
+     * @return Quantidade de instâncias com erro
+     * @throws TSPException se as entradas ou os arquivos de saída forem inválidos
+     */
+    size_t run(std::ostream& log) {
+        auto start = Clock::now();
+        std::vector<Instance> instances = collect(m_options.inputs);
+        if (!m_options.summaryPath.empty()) {
+            // Um resumo .csv gravado no diretório de entrada não é uma instância
+            std::error_code error;
+            auto summary = std::filesystem::weakly_canonical(m_options.summaryPath, error);
+            instances.erase(std::remove_if(instances.begin(), instances.end(), [&](const Instance& instance) {
+                std::error_code ignored;
+                return !error && std::filesystem::weakly_canonical(instance.path, ignored) == summary;
+            }), instances.end());
+        }
+        if (instances.empty()) throw TSPException("No instances found");
+        // As maiores primeiro: a última a terminar tende a ser pequena
+        std::stable_sort(instances.begin(), instances.end(),
+                         [](const Instance& a, const Instance& b) { return a.bytes > b.bytes; });
+
+        unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+        unsigned jobs = m_options.jobs ? m_options.jobs : cores;
+        jobs = static_cast<unsigned>(std::min<size_t>(jobs, instances.size()));
+        unsigned threads = std::max(1u, cores / jobs);
+
+        if (!m_options.toursDir.empty()) {
+            std::error_code error;
+            std::filesystem::create_directories(m_options.toursDir, error);
+            if (error) throw TSPException("Cannot create directory: " + m_options.toursDir);
+        }
+        if (!m_options.summaryPath.empty()) {
+            m_summary = std::make_unique<OutputBuffer>(m_options.summaryPath, 1 << 16);
+            writeSummaryHeader();
+        }
+
+        log << "📦 " << instances.size() << " instâncias, cadeia " << m_options.chain << ", "
+            << jobs << " em paralelo × " << threads << " threads";
+        if (m_options.timeLimitMs > 0) log << ", limite " << m_options.timeLimitMs << "ms";
+        log << std::endl;
+
+        m_finished = 0;
+        m_failed = 0;
+        ThreadPool pool(jobs);
+        pool.parallelFor(instances.size(), [&](size_t i, unsigned) {
+            Outcome outcome = solveOne(instances[i], threads);
+            report(instances[i], outcome, instances.size(), log);
+        }, 1);
+
+        if (m_summary) {
+            m_summary->close();
+            m_summary.reset();
+        }
+        log << "\n📊 " << instances.size() - m_failed << " ok, " << m_failed << " com erro em "
+            << elapsedMs(start) / 1000.0 << "s";
+        if (!m_options.summaryPath.empty()) log << " → " << m_options.summaryPath;
+        log << std::endl;
+        return m_failed;
+    }
+};
+
+#endif // BATCHSOLVER_H
@@ -0,0 +1,221 @@
+#ifndef COMMANDLINE_H
+#define COMMANDLINE_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdlib>
+#include <cerrno>
+
+#include "core/TSPAlgorithm.h"
+#include "core/TSPException.h"
+#include "algorithms/NearestNeighborTSP.h"
+#include "algorithms/GreedyEdgeTSP.h"
+#include "algorithms/ClarkeWrightTSP.h"
+#include "algorithms/SpanningTreeTSP.h"
+#include "algorithms/HilbertCurveTSP.h"
+#include "algorithms/InsertionTSP.h"
+#include "algorithms/SimulatedAnnealingTSP.h"
+#include "algorithms/GeneticTSP.h"
+#include "algorithms/AntColonyTSP.h"
+#include "algorithms/TwoOptTSP.h"
+#include "algorithms/OrOptTSP.h"
+#include "algorithms/LocalSearchTSP.h"
+#include "algorithms/LinKernighanTSP.h"
+#include "algorithms/ChainTSP.h"
+
+/**
+ * @brief Opções do modo em lote do tsp_optimizer
+ */
+struct BatchOptions {
+    std::vector<std::string> inputs;          ///< Instâncias, diretórios ou manifestos
+    std::string chain = "greedy,2opt,oropt";
+    long timeLimitMs = 0;                     ///< Por instância (0 = sem limite)
+    unsigned jobs = 0;                        ///< Instâncias simultâneas (0 = automático)
+    std::string summaryPath;                  ///< CSV de resultados (vazio = só no terminal)
+    std::string toursDir;                     ///< Grava a rota de cada instância (vazio = não grava)
+    std::string tourFormat = "tour";          ///< Extensão das rotas: tour, csv ou tourb
+    bool help = false;
+};
+
+/**
+ * @brief Linha de comando do tsp_optimizer: opções e cadeias de algoritmos
+ *
+ * Uma cadeia é uma lista separada por vírgulas: o primeiro nome é o
+ * construtivo e os seguintes são melhorias aplicadas em sequência, ex.
+ * "greedy,2opt,oropt" ou "christofides,lk".
+ */
+class CommandLine {
+private:
+    struct Constructor {
+        const char* name;
+        const char* description;
+        std::unique_ptr<TSPAlgorithm> (*create)();
+    };
+
+    struct Improver {
+        const char* name;
+        const char* description;
+        void (*append)(ChainTSP& chain);
+    };
+
+    static const std::vector<Constructor>& constructors() {
+        static const std::vector<Constructor> table = {
+            {"nn", "Nearest Neighbor", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<NearestNeighborTSP>(); }},
+            {"greedy", "Greedy Edge", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<GreedyEdgeTSP>(); }},
+            {"savings", "Clarke-Wright Savings", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<ClarkeWrightTSP>(); }},
+            {"christofides", "Christofides", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<ChristofidesTSP>(); }},
+            {"doubletree", "Double Tree", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<DoubleTreeTSP>(); }},
+            {"hilbert", "Hilbert Curve", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<HilbertCurveTSP>(); }},
+            {"nearest", "Nearest Insertion", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<NearestInsertionTSP>(); }},
+            {"farthest", "Farthest Insertion", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<FarthestInsertionTSP>(); }},
+            {"cheapest", "Cheapest Insertion", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<CheapestInsertionTSP>(); }},
+            {"hull", "Convex Hull Insertion", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<ConvexHullInsertionTSP>(); }},
+            {"sa", "Simulated Annealing", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<SimulatedAnnealingTSP>(); }},
+            {"ga", "Genetic Algorithm", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<GeneticTSP>(); }},
+            {"aco", "Ant Colony", [] () -> std::unique_ptr<TSPAlgorithm> { return std::make_unique<AntColonyTSP>(); }},
+        };
+        return table;
+    }
+
+    // As melhorias não usam o construtivo próprio: só improve() é chamado
+    static const std::vector<Improver>& improvers() {
+        static const std::vector<Improver> table = {
+            {"2opt", "2-opt", [] (ChainTSP& chain) { chain.addStage(std::make_unique<TwoOptTSP>(nullptr)); }},
+            {"oropt", "Or-opt", [] (ChainTSP& chain) { chain.addStage(std::make_unique<OrOptTSP>(nullptr)); }},
+            {"ls", "2-opt + Or-opt + or-2h", [] (ChainTSP& chain) { chain.addStage(std::make_unique<LocalSearchTSP>(nullptr)); }},
+            {"lk", "Lin-Kernighan", [] (ChainTSP& chain) { chain.addStage(std::make_unique<LinKernighanTSP>(nullptr)); }},
+            {"sa", "Simulated Annealing", [] (ChainTSP& chain) { chain.addStage(std::make_unique<SimulatedAnnealingTSP>(nullptr)); }},
+        };
+        return table;
+    }
+
+    static std::vector<std::string> split(const std::string& text, char separator) {
+        std::vector<std::string> parts;
+        size_t start = 0;
+        for (;;) {
+            size_t stop = text.find(separator, start);
+            parts.push_back(text.substr(start, stop - start));
+            if (stop == std::string::npos) return parts;
+            start = stop + 1;
+        }
+    }
+
+public:
+    /**
+     * @brief Inteiro não negativo de uma opção (texto inteiro, sem sobras)
+     * @throws TSPException com a opção e o texto inválido
+     */
+    static long parseNumber(const std::string& option, const char* text) {
+        char* end = nullptr;
+        errno = 0;
+        long value = std::strtol(text, &end, 10);
+        if (errno != 0 || end == text || *end != '\0' || value < 0) {
+            throw TSPException("Invalid value for " + option + ": " + text);
+        }
+        return value;
+    }
+
+    /**
+     * @brief Monta a cadeia descrita por spec (ex. "greedy,2opt,oropt")
+     * @throws TSPException se algum nome não existir ou estiver fora de lugar
+     */
+    static std::unique_ptr<ChainTSP> makeChain(const std::string& spec) {
+        std::vector<std::string> names = split(spec, ',');
+        std::unique_ptr<ChainTSP> chain;
+        for (const Constructor& entry : constructors()) {
+            if (names[0] == entry.name) chain = std::make_unique<ChainTSP>(entry.create());
+        }
+        if (!chain) throw TSPException("Unknown construction algorithm: " + names[0]);
+
+        for (size_t i = 1; i < names.size(); ++i) {
+            bool found = false;
+            for (const Improver& entry : improvers()) {
+                if (names[i] == entry.name) {
+                    entry.append(*chain);
+                    found = true;
+                }
+            }
+            if (!found) throw TSPException("Unknown improvement algorithm: " + names[i]);
+        }
+        return chain;
+    }
+
+    /// Nomes das etapas da cadeia, na ordem (para o resumo)
+    static std::vector<std::string> chainNames(const std::string& spec) { return split(spec, ','); }
+
+    /**
+     * @brief Interpreta os argumentos do modo em lote
+     * @throws TSPException com a opção inválida
+     */
+    static BatchOptions parse(int argc, char** argv) {
+        BatchOptions options;
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> const char* {
+                if (i + 1 >= argc) throw TSPException("Missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "-h" || arg == "--help") {
+                options.help = true;
+            } else if (arg == "-c" || arg == "--chain") {
+                options.chain = value();
+            } else if (arg == "-t" || arg == "--time-limit") {
+                options.timeLimitMs = parseNumber(arg, value());
+            } else if (arg == "-j" || arg == "--jobs") {
+                options.jobs = static_cast<unsigned>(parseNumber(arg, value()));
+            } else if (arg == "-o" || arg == "--summary") {
+                options.summaryPath = value();
+            } else if (arg == "--tours") {
+                options.toursDir = value();
+            } else if (arg == "--tour-format") {
+                options.tourFormat = value();
+                if (options.tourFormat != "tour" && options.tourFormat != "csv" && options.tourFormat != "tourb") {
+                    throw TSPException("Invalid value for " + arg + ": " + options.tourFormat);
+                }
+            } else if (arg.size() > 1 && arg[0] == '-') {
+                throw TSPException("Unknown option: " + arg);
+            } else {
+                options.inputs.push_back(arg);
+            }
+        }
+        if (!options.help) {
+            if (options.inputs.empty()) throw TSPException("No input instances");
+            makeChain(options.chain);     // valida a cadeia antes de carregar qualquer instância
+        }
+        return options;
+    }
+
+    static std::string usage(const std::string& program) {
+        std::string text =
+            "Uso:\n"
+            "  " + program + "                       demonstração\n"
+            "  " + program + " [opções] entrada...   resolve instâncias em lote\n"
+            "  " + program + " --convert entrada.(tsp|csv|jsonl) saida.tspb [vizinhos]\n"
+            "\n"
+            "Entradas: instâncias (.tsp, .tspb, .csv, .jsonl), diretórios (arquivos de\n"
+            "instância, sem subdiretórios) ou manifestos (um caminho por linha, relativo\n"
+            "ao manifesto; linhas vazias e com # são ignoradas).\n"
+            "\n"
+            "Opções:\n"
+            "  -c, --chain LISTA       construtivo e melhorias (padrão greedy,2opt,oropt)\n"
+            "  -t, --time-limit MS     limite por instância, 0 = sem limite (padrão 0)\n"
+            "  -j, --jobs N            instâncias simultâneas (padrão: núcleos)\n"
+            "  -o, --summary ARQUIVO   resultados em CSV, uma linha por instância\n"
+            "      --tours DIR         grava a rota de cada instância em DIR\n"
+            "      --tour-format EXT   tour, csv ou tourb (padrão tour)\n"
+            "  -h, --help              esta ajuda\n"
+            "\n"
+            "Construtivos:\n";
+        auto row = [&](const std::string& name, const char* description) {
+            text += "  " + name + std::string(name.size() < 14 ? 14 - name.size() : 1, ' ') + description + "\n";
+        };
+        for (const Constructor& entry : constructors()) row(entry.name, entry.description);
+        text += "Melhorias:\n";
+        for (const Improver& entry : improvers()) row(entry.name, entry.description);
+        return text;
+    }
+};
+
+#endif // COMMANDLINE_H
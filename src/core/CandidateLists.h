@@ -0,0 +1,120 @@
+#ifndef CANDIDATELISTS_H
+#define CANDIDATELISTS_H
+
+#include <vector>
+#include <cstdint>
+#include <thread>
+#include <algorithm>
+
+#include "core/Graph.h"
+#include "core/KDTree.h"
+
+/**
+ * @brief Listas de candidatos: os k vizinhos mais próximos de cada cidade
+ *
+ * Armazenadas em um único array plano (n x k), em ordem crescente de
+ * distância. Construídas com o KDTree em paralelo (consultas ao índice
+ * são somente leitura). Para métricas que não seguem as coordenadas
+ * (GEO, matriz explícita) as linhas da matriz de distâncias são varridas.
+ *
+ * Se o grafo traz listas prontas com pelo menos k vizinhos (arquivo .tspb,
+ * ver Graph::getStoredNeighbors), elas são usadas no lugar, sem cálculo
+ * nem cópia; nesse caso as listas valem enquanto o grafo não mudar. Restringem os movimentos da busca local às
+ * arestas curtas, que são as únicas com chance real de melhorar a rota.
+ */
+class CandidateLists {
+private:
+    std::vector<uint32_t> m_neighbors;
+    const uint32_t* m_data = nullptr;   ///< m_neighbors ou as listas guardadas no grafo
+    size_t m_stride = 0;                ///< Distância entre linhas (>= k com listas guardadas)
+    size_t m_size;
+    size_t m_k;
+
+public:
+    CandidateLists() : m_size(0), m_k(0) {}
+
+    // m_data aponta para m_neighbors: mover preserva o buffer, copiar não
+    CandidateLists(const CandidateLists&) = delete;
+    CandidateLists& operator=(const CandidateLists&) = delete;
+    CandidateLists(CandidateLists&&) = default;
+    CandidateLists& operator=(CandidateLists&&) = default;
+
+    CandidateLists(const Graph& graph, size_t k, unsigned threads = 0) : m_size(0), m_k(0) {
+        build(graph, k, threads);
+    }
+
+    void build(const Graph& graph, size_t k, unsigned threads = 0) {
+        m_size = graph.size();
+        m_k = m_size > 1 ? std::min(k, m_size - 1) : 0;
+        if (m_k > 0 && graph.getStoredNeighborCount() >= m_k) {
+            // Prefixo de cada lista guardada (já em ordem crescente)
+            m_neighbors.clear();
+            m_data = graph.getStoredNeighbors();
+            m_stride = graph.getStoredNeighborCount();
+            return;
+        }
+        m_neighbors.assign(m_size * m_k, 0);
+        m_data = m_neighbors.data();
+        m_stride = m_k;
+        if (m_k == 0) return;
+
+        if (!followsCoordinates(graph.getDistanceConfig().metric)) {
+            buildFromMatrix(graph, threads);
+            return;
+        }
+
+        KDTree index(graph);
+        run(threads, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                auto nearest = index.kNearest(static_cast<uint32_t>(i), m_k);
+                uint32_t* row = m_neighbors.data() + i * m_k;
+                for (size_t j = 0; j < nearest.size(); ++j) row[j] = nearest[j].second;
+            }
+        });
+    }
+
+    /// Ponteiro para os k vizinhos da cidade (ordem crescente de distância)
+    const uint32_t* of(uint32_t city) const { return m_data + size_t(city) * m_stride; }
+
+    size_t k() const { return m_k; }
+    size_t size() const { return m_size; }
+
+private:
+    /// Varredura O(n²) das linhas da matriz, para métricas sem índice espacial
+    void buildFromMatrix(const Graph& graph, unsigned threads) {
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        run(threads, [&](size_t begin, size_t end) {
+            std::vector<uint32_t> others(m_size - 1);
+            for (size_t i = begin; i < end; ++i) {
+                for (size_t j = 0, t = 0; j < m_size; ++j) {
+                    if (j != i) others[t++] = static_cast<uint32_t>(j);
+                }
+                std::partial_sort(others.begin(), others.begin() + m_k, others.end(),
+                                  [&](uint32_t a, uint32_t b) {
+                                      double da = dist.at(i, a), db = dist.at(i, b);
+                                      return da < db || (da == db && a < b);
+                                  });
+                std::copy(others.begin(), others.begin() + m_k, m_neighbors.data() + i * m_k);
+            }
+        });
+    }
+
+    template <typename Worker>
+    void run(unsigned threads, Worker worker) const {
+        unsigned threadCount = threads ? threads : std::thread::hardware_concurrency();
+        if (threadCount == 0 || m_size < 4096) threadCount = 1;
+        if (threadCount == 1) {
+            worker(0, m_size);
+            return;
+        }
+        std::vector<std::thread> pool;
+        size_t chunk = (m_size + threadCount - 1) / threadCount;
+        for (unsigned t = 0; t < threadCount; ++t) {
+            size_t begin = t * chunk, end = std::min(m_size, begin + chunk);
+            if (begin < end) pool.emplace_back(worker, begin, end);
+        }
+        for (auto& th : pool) th.join();
+    }
+};
+
+#endif // CANDIDATELISTS_H
@@ -0,0 +1,142 @@
+#ifndef COORDINATESTORE_H
+#define COORDINATESTORE_H
+
+#include <memory>
+#include <cstddef>
+
+#include "core/AlignedAllocator.h"
+
+/**
+ * @brief Arrays x[] e y[] do Graph, próprios ou em memória externa
+ *
+ * As leituras passam sempre pelos ponteiros m_px/m_py, que apontam para os
+ * vetores próprios ou para memória somente leitura de outro dono (ex.:
+ * arquivo .tspb mapeado), mantida viva por um shared_ptr. Qualquer
+ * alteração copia primeiro os dados externos para os vetores próprios
+ * (copy-on-write), então quem só lê nunca paga cópia.
+ *
+ * Demonstra conceitos POO:
+ * - Encapsulamento: a origem dos dados é invisível para o Graph
+ * - Regra dos cinco: cópia e movimento reapontam as visões
+ */
+class CoordinateStore {
+private:
+    AlignedVector<double> m_x;
+    AlignedVector<double> m_y;
+    std::shared_ptr<const void> m_owner;    ///< Dono da memória externa (nulo = vetores próprios)
+    const double* m_px = nullptr;
+    const double* m_py = nullptr;
+    size_t m_count = 0;
+
+    void sync() {
+        if (m_owner) return;
+        m_px = m_x.data();
+        m_py = m_y.data();
+        m_count = m_x.size();
+    }
+
+public:
+    CoordinateStore() = default;
+
+    CoordinateStore(const CoordinateStore& other)
+        : m_x(other.m_x), m_y(other.m_y), m_owner(other.m_owner),
+          m_px(other.m_px), m_py(other.m_py), m_count(other.m_count) {
+        sync();
+    }
+
+    CoordinateStore(CoordinateStore&& other) noexcept
+        : m_x(std::move(other.m_x)), m_y(std::move(other.m_y)), m_owner(std::move(other.m_owner)),
+          m_px(other.m_px), m_py(other.m_py), m_count(other.m_count) {
+        sync();
+        other.clear();
+    }
+
+    CoordinateStore& operator=(const CoordinateStore& other) {
+        if (this != &other) {
+            m_x = other.m_x;
+            m_y = other.m_y;
+            m_owner = other.m_owner;
+            m_px = other.m_px;
+            m_py = other.m_py;
+            m_count = other.m_count;
+            sync();
+        }
+        return *this;
+    }
+
+    CoordinateStore& operator=(CoordinateStore&& other) noexcept {
+        if (this != &other) {
+            m_x = std::move(other.m_x);
+            m_y = std::move(other.m_y);
+            m_owner = std::move(other.m_owner);
+            m_px = other.m_px;
+            m_py = other.m_py;
+            m_count = other.m_count;
+            sync();
+            other.clear();
+        }
+        return *this;
+    }
+
+    double x(size_t index) const { return m_px[index]; }
+    double y(size_t index) const { return m_py[index]; }
+    const double* xData() const { return m_px; }
+    const double* yData() const { return m_py; }
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    /// true se os dados estão em memória externa (ainda não copiados)
+    bool isExternal() const { return m_owner != nullptr; }
+
+    /**
+     * @brief Passa a ler de memória externa, sem cópia
+     * @param owner Mantém xs/ys válidos enquanto houver leitores
+     */
+    void attach(std::shared_ptr<const void> owner, const double* xs, const double* ys, size_t count) {
+        m_x.clear();
+        m_y.clear();
+        m_owner = std::move(owner);
+        m_px = xs;
+        m_py = ys;
+        m_count = count;
+    }
+
+    /// Copia os dados externos para os vetores próprios
+    void detach() {
+        if (!m_owner) return;
+        m_x.assign(m_px, m_px + m_count);
+        m_y.assign(m_py, m_py + m_count);
+        m_owner.reset();
+        sync();
+    }
+
+    void assign(AlignedVector<double> xs, AlignedVector<double> ys) {
+        m_owner.reset();
+        m_x = std::move(xs);
+        m_y = std::move(ys);
+        sync();
+    }
+
+    void push_back(double x, double y) {
+        detach();
+        m_x.push_back(x);
+        m_y.push_back(y);
+        sync();
+    }
+
+    void reserve(size_t count) {
+        detach();
+        m_x.reserve(count);
+        m_y.reserve(count);
+        sync();
+    }
+
+    void clear() {
+        m_owner.reset();
+        m_x.clear();
+        m_y.clear();
+        sync();
+    }
+};
+
+#endif // COORDINATESTORE_H
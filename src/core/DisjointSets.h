@@ -0,0 +1,56 @@
+#ifndef DISJOINTSETS_H
+#define DISJOINTSETS_H
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+/**
+ * @brief União-busca (union-find) sobre índices 0..n-1
+ *
+ * Compressão de caminho por halving e união por tamanho: find e unite
+ * custam O(α(n)) amortizado. Usada para rejeitar subciclos na construção
+ * gulosa e na árvore geradora mínima (Kruskal/Borůvka).
+ */
+class DisjointSets {
+private:
+    std::vector<uint32_t> m_parent;
+    std::vector<uint32_t> m_size;
+    size_t m_count;
+
+public:
+    explicit DisjointSets(size_t n = 0) { reset(n); }
+
+    void reset(size_t n) {
+        m_parent.resize(n);
+        m_size.assign(n, 1);
+        for (size_t i = 0; i < n; ++i) m_parent[i] = static_cast<uint32_t>(i);
+        m_count = n;
+    }
+
+    uint32_t find(uint32_t x) {
+        while (m_parent[x] != x) {
+            m_parent[x] = m_parent[m_parent[x]];
+            x = m_parent[x];
+        }
+        return x;
+    }
+
+    /// Une os conjuntos de a e b; false se já estavam juntos
+    bool unite(uint32_t a, uint32_t b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) return false;
+        if (m_size[a] < m_size[b]) std::swap(a, b);
+        m_parent[b] = a;
+        m_size[a] += m_size[b];
+        --m_count;
+        return true;
+    }
+
+    /// Número de conjuntos disjuntos
+    size_t count() const { return m_count; }
+    size_t size() const { return m_parent.size(); }
+};
+
+#endif // DISJOINTSETS_H
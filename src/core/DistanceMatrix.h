@@ -0,0 +1,294 @@
+#ifndef DISTANCEMATRIX_H
+#define DISTANCEMATRIX_H
+
+#include <vector>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+/// Precisão usada para armazenar as distâncias
+enum class DistancePrecision { Double, Float };
+
+/**
+ * @brief Função de distância entre dois pontos
+ *
+ * Euclidean é a distância real; as demais seguem as definições da TSPLIB
+ * (valores inteiros), para que os comprimentos batam com os ótimos
+ * publicados. Explicit usa uma matriz fornecida (Graph::setExplicitDistances).
+ */
+enum class DistanceMetric {
+    Euclidean,
+    Euc2D,      ///< TSPLIB EUC_2D: euclidiana arredondada
+    Ceil2D,     ///< TSPLIB CEIL_2D: euclidiana arredondada para cima
+    Geo,        ///< TSPLIB GEO: distância geográfica (x = latitude, y = longitude, DDD.MM)
+    Att,        ///< TSPLIB ATT: pseudo-euclidiana
+    Explicit    ///< Matriz explícita
+};
+
+/**
+ * @brief true se a ordem das distâncias segue a distância euclidiana das
+ *        coordenadas, ou seja, se índices espaciais (KDTree) dão os vizinhos
+ *        corretos
+ */
+inline bool followsCoordinates(DistanceMetric metric) {
+    return metric != DistanceMetric::Geo && metric != DistanceMetric::Explicit;
+}
+
+/**
+ * @brief Parâmetros de construção da matriz de distâncias
+ */
+struct DistanceMatrixConfig {
+    DistancePrecision precision = DistancePrecision::Double;  ///< Tipo de armazenamento
+    size_t maxPrecomputedSize = 5000;  ///< Acima disso calcula sob demanda
+    unsigned threads = 0;              ///< 0 = hardware_concurrency()
+    DistanceMetric metric = DistanceMetric::Euclidean;
+};
+
+/**
+ * @brief Matriz de distâncias pré-calculada para o grafo TSP
+ *
+ * Armazena todas as distâncias em um bloco contíguo row-major (n x n),
+ * construído uma única vez e em paralelo. Acima de um tamanho configurável
+ * a matriz não é alocada e as distâncias são calculadas sob demanda a
+ * partir das coordenadas, lidas direto do array do chamador (sem cópia,
+ * o que preserva o mapeamento de um .tspb); só a métrica Geo guarda uma
+ * cópia, já convertida para radianos. Nesse modo os arrays passados a
+ * build devem continuar válidos enquanto a matriz for usada.
+ *
+ * Demonstra conceitos POO:
+ * - Encapsulamento: o modo de armazenamento fica escondido atrás de at()
+ * - STL: std::vector e std::thread
+ */
+class DistanceMatrix {
+public:
+    using Precision = DistancePrecision;
+    using Config = DistanceMatrixConfig;
+
+    /// Modo efetivo após a construção
+    enum class Mode { Empty, PrecomputedDouble, PrecomputedFloat, OnTheFly };
+
+private:
+    const double* m_xs = nullptr;       ///< Coordenadas lidas por compute()
+    const double* m_ys = nullptr;
+    std::vector<double> m_x, m_y;       ///< Cópia em radianos (só Geo)
+    std::vector<double> m_double;
+    std::vector<float> m_float;
+    size_t m_size;
+    Mode m_mode;
+    DistanceMetric m_metric = DistanceMetric::Euclidean;
+
+    double compute(size_t from, size_t to) const {
+        double dx = m_xs[from] - m_xs[to];
+        double dy = m_ys[from] - m_ys[to];
+        if (m_metric == DistanceMetric::Euclidean) return std::sqrt(dx * dx + dy * dy);
+        return computeTsplib(from, to, dx, dy);
+    }
+
+    double computeTsplib(size_t from, size_t to, double dx, double dy) const {
+        switch (m_metric) {
+            case DistanceMetric::Euc2D:
+                return std::floor(std::sqrt(dx * dx + dy * dy) + 0.5);
+            case DistanceMetric::Ceil2D:
+                return std::ceil(std::sqrt(dx * dx + dy * dy));
+            case DistanceMetric::Att: {
+                double r = std::sqrt((dx * dx + dy * dy) / 10.0);
+                double t = std::floor(r + 0.5);
+                return t < r ? t + 1.0 : t;
+            }
+            case DistanceMetric::Geo: {
+                // m_xs/m_ys apontam para latitude/longitude já em radianos
+                if (from == to) return 0.0;
+                const double RRR = 6378.388;
+                double q1 = std::cos(m_ys[from] - m_ys[to]);
+                double q2 = std::cos(m_xs[from] - m_xs[to]);
+                double q3 = std::cos(m_xs[from] + m_xs[to]);
+                return std::floor(RRR * std::acos(0.5 * ((1.0 + q1) * q2 - (1.0 - q1) * q3)) + 1.0);
+            }
+            default:
+                return std::sqrt(dx * dx + dy * dy);
+        }
+    }
+
+    /// Graus.minutos (DDD.MM) da TSPLIB para radianos
+    static double geoToRadians(double value) {
+        const double PI = 3.141592;     // valor fixado pela TSPLIB
+        double degrees = std::trunc(value);
+        double minutes = value - degrees;
+        return PI * (degrees + 5.0 * minutes / 3.0) / 180.0;
+    }
+
+    template <typename T>
+    void fill(std::vector<T>& cells, unsigned threadCount) {
+        cells.assign(m_size * m_size, T(0));
+
+        // Cada thread processa linhas intercaladas do triângulo superior e
+        // espelha o valor; como cada célula é escrita por uma única thread,
+        // não há necessidade de sincronização.
+        auto worker = [this, &cells, threadCount](unsigned id) {
+            for (size_t i = id; i < m_size; i += threadCount) {
+                T* row = cells.data() + i * m_size;
+                for (size_t j = i + 1; j < m_size; ++j) {
+                    T d = static_cast<T>(compute(i, j));
+                    row[j] = d;
+                    cells[j * m_size + i] = d;
+                }
+            }
+        };
+
+        if (threadCount <= 1) {
+            worker(0);
+            return;
+        }
+
+        std::vector<std::thread> pool;
+        pool.reserve(threadCount);
+        for (unsigned t = 0; t < threadCount; ++t) {
+            pool.emplace_back(worker, t);
+        }
+        for (auto& th : pool) th.join();
+    }
+
+    /// A cópia em radianos (Geo) é própria: os ponteiros passam a apontar para ela
+    void rebindOwnCoordinates() {
+        if (!m_x.empty()) {
+            m_xs = m_x.data();
+            m_ys = m_y.data();
+        }
+    }
+
+public:
+    DistanceMatrix() : m_size(0), m_mode(Mode::Empty) {}
+
+    DistanceMatrix(const DistanceMatrix& other)
+        : m_xs(other.m_xs), m_ys(other.m_ys), m_x(other.m_x), m_y(other.m_y),
+          m_double(other.m_double), m_float(other.m_float), m_size(other.m_size),
+          m_mode(other.m_mode), m_metric(other.m_metric) {
+        rebindOwnCoordinates();
+    }
+
+    DistanceMatrix& operator=(const DistanceMatrix& other) {
+        if (this != &other) {
+            DistanceMatrix copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    DistanceMatrix(DistanceMatrix&&) noexcept = default;
+    DistanceMatrix& operator=(DistanceMatrix&&) noexcept = default;
+
+    /**
+     * @brief Constrói a matriz a partir das coordenadas
+     * @param xs Array de coordenadas X (referenciado, não copiado, no modo OnTheFly)
+     * @param ys Array de coordenadas Y
+     * @param n Número de pontos
+     * @param config Precisão, limite de pré-cálculo e número de threads
+     */
+    void build(const double* xs, const double* ys, size_t n,
+               const Config& config = Config()) {
+        clear();
+        if (n == 0) return;
+        if (config.metric == DistanceMetric::Explicit) {
+            throw std::invalid_argument("Explicit distances require buildExplicit");
+        }
+        m_size = n;
+        m_metric = config.metric;
+        m_xs = xs;
+        m_ys = ys;
+        if (m_metric == DistanceMetric::Geo) {
+            m_x.resize(n);
+            m_y.resize(n);
+            for (size_t i = 0; i < n; ++i) {
+                m_x[i] = geoToRadians(xs[i]);
+                m_y[i] = geoToRadians(ys[i]);
+            }
+            rebindOwnCoordinates();
+        }
+
+        if (m_size > config.maxPrecomputedSize) {
+            m_mode = Mode::OnTheFly;
+            return;
+        }
+
+        unsigned threadCount = config.threads ? config.threads
+                                              : std::thread::hardware_concurrency();
+        // Para grafos pequenos o custo de criar threads supera o ganho
+        if (threadCount == 0 || m_size < 512) threadCount = 1;
+        threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, m_size));
+
+        if (config.precision == Precision::Float) {
+            fill(m_float, threadCount);
+            m_mode = Mode::PrecomputedFloat;
+        } else {
+            fill(m_double, threadCount);
+            m_mode = Mode::PrecomputedDouble;
+        }
+        // As células já estão prontas: nada mais lê as coordenadas
+        m_xs = m_ys = nullptr;
+        m_x = std::vector<double>();
+        m_y = std::vector<double>();
+    }
+
+    /**
+     * @brief Usa uma matriz de distâncias pronta (n x n, row-major)
+     */
+    void buildExplicit(const double* cells, size_t n) {
+        clear();
+        m_metric = DistanceMetric::Explicit;
+        if (n == 0) return;
+        m_double.assign(cells, cells + n * n);
+        m_size = n;
+        m_mode = Mode::PrecomputedDouble;
+    }
+
+    void clear() {
+        m_xs = m_ys = nullptr;
+        m_x.clear();
+        m_y.clear();
+        m_double.clear();
+        m_float.clear();
+        m_size = 0;
+        m_mode = Mode::Empty;
+        m_metric = DistanceMetric::Euclidean;
+    }
+
+    /**
+     * @brief Distância entre dois índices (sem verificação de limites)
+     */
+    double at(size_t from, size_t to) const {
+        switch (m_mode) {
+            case Mode::PrecomputedDouble: return m_double[from * m_size + to];
+            case Mode::PrecomputedFloat:  return m_float[from * m_size + to];
+            default:                      return compute(from, to);
+        }
+    }
+
+    double operator()(size_t from, size_t to) const { return at(from, to); }
+
+    size_t size() const { return m_size; }
+    Mode getMode() const { return m_mode; }
+    DistanceMetric getMetric() const { return m_metric; }
+    bool isPrecomputed() const {
+        return m_mode == Mode::PrecomputedDouble || m_mode == Mode::PrecomputedFloat;
+    }
+
+    /**
+     * @brief false se a matriz lê coordenadas externas que não são xs
+     *        (ex.: o dono das coordenadas foi copiado ou realocado)
+     */
+    bool readsFrom(const double* xs) const {
+        return m_mode != Mode::OnTheFly || !m_x.empty() || m_xs == xs;
+    }
+
+    /**
+     * @brief Memória ocupada pelas distâncias armazenadas (bytes)
+     */
+    size_t memoryUsage() const {
+        return m_double.size() * sizeof(double) + m_float.size() * sizeof(float);
+    }
+};
+
+#endif // DISTANCEMATRIX_H
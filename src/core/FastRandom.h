@@ -0,0 +1,63 @@
+#ifndef FASTRANDOM_H
+#define FASTRANDOM_H
+
+#include <cstdint>
+
+/**
+ * @brief Gerador pseudoaleatório pequeno e rápido (xoshiro256**)
+ *
+ * O estado ocupa 32 bytes e é iniciado com splitmix64, então criar um
+ * gerador por tarefa (por filho, por formiga) é barato. Derivar a semente
+ * de (semente global, geração, índice) torna o resultado independente da
+ * ordem em que as threads executam as tarefas.
+ */
+class FastRandom {
+private:
+    uint64_t m_state[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    static uint64_t splitmix64(uint64_t& x) {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /// Combina valores em uma semente (por exemplo semente, geração e índice)
+    static uint64_t mix(uint64_t a, uint64_t b, uint64_t c = 0) {
+        uint64_t x = a;
+        uint64_t h = splitmix64(x) ^ b;
+        h = splitmix64(h) ^ c;
+        return splitmix64(h);
+    }
+
+    explicit FastRandom(uint64_t seed = 0x853C49E6748FEA9BULL) { reseed(seed); }
+
+    void reseed(uint64_t seed) {
+        for (auto& word : m_state) word = splitmix64(seed);
+    }
+
+    uint64_t next() {
+        uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+        uint64_t t = m_state[1] << 17;
+        m_state[2] ^= m_state[0];
+        m_state[3] ^= m_state[1];
+        m_state[1] ^= m_state[2];
+        m_state[0] ^= m_state[3];
+        m_state[2] ^= t;
+        m_state[3] = rotl(m_state[3], 45);
+        return result;
+    }
+
+    /// Inteiro uniforme em [0, bound) (método de Lemire, viés desprezível)
+    uint32_t uniform(uint32_t bound) {
+        return static_cast<uint32_t>(((next() >> 32) * static_cast<uint64_t>(bound)) >> 32);
+    }
+
+    /// Real uniforme em [0, 1)
+    double uniformReal() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+};
+
+#endif // FASTRANDOM_H
@@ -0,0 +1,496 @@
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <thread>
+#include <memory>
+
+#include "core/Point.h"
+#include "core/TSPException.h"
+#include "core/AlignedAllocator.h"
+#include "core/StringTable.h"
+#include "core/CoordinateStore.h"
+#include "core/DistanceMatrix.h"
+#include "core/SpatialHashGrid.h"
+#include "core/SpaceFillingCurve.h"
+
+/**
+ * @brief Classe que representa um grafo completo de pontos
+ *
+ * As coordenadas são armazenadas em estrutura de arrays (x[] e y[]
+ * contíguos e alinhados) e os nomes ficam em uma tabela de strings
+ * separada, endereçada por índice. Assim as varreduras de distância dos
+ * algoritmos tocam apenas doubles; Point é materializado sob demanda.
+ *
+ * A detecção de duplicatas usa uma grade com hash (célula = tolerância),
+ * tornando addPoint O(1) em média. A grade é atualizada de forma
+ * preguiçosa, então cargas confiáveis sem verificação não pagam por ela.
+ *
+ * Os pontos podem ser renumerados em ordem espacial (renumber): cidades
+ * próximas passam a ter índices próximos, o que melhora a localidade de
+ * todas as varreduras dos algoritmos. A permutação aplicada fica guardada
+ * e getOriginalId traduz os índices de volta para a ordem de inserção.
+ *
+ * Os pontos também podem vir de memória externa somente leitura
+ * (attachMapped, ex.: arquivo .tspb mapeado): coordenadas e listas de
+ * vizinhos são lidas no lugar e os nomes só são montados no primeiro
+ * acesso. Qualquer alteração copia os dados antes (ver CoordinateStore).
+ *
+ * Instâncias TSPLIB com EDGE_WEIGHT_TYPE EXPLICIT guardam a matriz
+ * fornecida (setExplicitDistances); as coordenadas servem só para exibição.
+ *
+ * Demonstra conceitos POO:
+ * - Composição: Graph contém coordenadas, nomes e matriz de distâncias
+ * - STL: uso de std::vector
+ * - Tratamento de exceções
+ */
+class Graph {
+public:
+    /**
+     * @brief Pontos em memória externa somente leitura (ver attachMapped)
+     */
+    struct MappedPoints {
+        std::shared_ptr<const void> owner;      ///< Mantém a memória válida
+        const double* x = nullptr;
+        const double* y = nullptr;
+        size_t count = 0;
+        const uint64_t* nameOffsets = nullptr;  ///< count + 1 deslocamentos em nameChars (opcional)
+        const char* nameChars = nullptr;
+        const uint32_t* neighbors = nullptr;    ///< count x neighborCount, ordem crescente (opcional)
+        size_t neighborCount = 0;
+        DistanceMetric metric = DistanceMetric::Euclidean;
+    };
+
+private:
+    CoordinateStore m_coords;
+    mutable std::vector<uint32_t> m_nameIds;
+    std::vector<uint32_t> m_originalIds;  ///< Vazio = pontos na ordem de inserção
+    mutable StringTable m_names;
+    MappedPoints m_mapped;                ///< Nomes e vizinhos externos ainda válidos
+    mutable bool m_namesPending = false;  ///< Nomes externos ainda não internados
+    double m_duplicateTolerance = 1e-9;
+    SpatialHashGrid m_grid;
+    size_t m_gridSize = 0;             ///< Pontos já registrados na grade
+
+    DistanceMatrix::Config m_matrixConfig;
+    std::vector<double> m_explicit;    ///< Matriz n x n fornecida (métrica Explicit)
+    mutable DistanceMatrix m_matrix;
+    mutable bool m_matrixReady = false;
+
+    void checkIndex(size_t index) const {
+        if (index >= m_coords.size()) {
+            throw TSPException("Index out of bounds");
+        }
+    }
+
+    bool dedupEnabled() const { return m_duplicateTolerance > 0.0; }
+
+    bool isNear(size_t index, double x, double y) const {
+        return std::abs(m_coords.x(index) - x) < m_duplicateTolerance &&
+               std::abs(m_coords.y(index) - y) < m_duplicateTolerance;
+    }
+
+    void syncGrid() {
+        if (m_gridSize == 0) m_grid.reset(m_duplicateTolerance);
+        for (; m_gridSize < m_coords.size(); ++m_gridSize) {
+            m_grid.insert(static_cast<uint32_t>(m_gridSize), m_coords.x(m_gridSize), m_coords.y(m_gridSize));
+        }
+    }
+
+    bool existsNear(double x, double y) const {
+        return m_grid.forEachNear(x, y, [&](uint32_t i) { return isNear(i, x, y); });
+    }
+
+    /// Interna os nomes de pontos externos (no primeiro acesso aos nomes)
+    void ensureNames() const {
+        if (!m_namesPending) return;
+        m_namesPending = false;
+        m_nameIds.assign(m_coords.size(), 0);
+        if (!m_mapped.nameOffsets) return;
+        for (size_t i = 0; i < m_coords.size(); ++i) {
+            m_nameIds[i] = m_names.intern(std::string(m_mapped.nameChars + m_mapped.nameOffsets[i],
+                                                      m_mapped.nameChars + m_mapped.nameOffsets[i + 1]));
+        }
+    }
+
+    /// Antes de alterar os pontos: copia os dados externos e descarta os vizinhos
+    void detachMapped() {
+        ensureNames();
+        m_coords.detach();
+        m_mapped = MappedPoints();
+    }
+
+    void append(const Point& point) {
+        m_coords.push_back(point.getX(), point.getY());
+        m_nameIds.push_back(m_names.intern(point.getName()));
+        if (!m_originalIds.empty()) m_originalIds.push_back(static_cast<uint32_t>(m_originalIds.size()));
+    }
+
+    void checkAppendable() const {
+        if (!m_explicit.empty()) throw TSPException("Cannot add points to a graph with explicit distances");
+    }
+
+public:
+    void addPoint(const Point& point) {
+        checkAppendable();
+        if (dedupEnabled()) {
+            syncGrid();
+            if (existsNear(point.getX(), point.getY())) {
+                throw TSPException("Point already exists");
+            }
+        }
+        detachMapped();
+        append(point);
+        m_matrixReady = false;
+    }
+
+    /**
+     * @brief Adiciona um lote de pontos, descartando duplicatas
+     *
+     * As células e as comparações com os pontos existentes e com os pontos
+     * anteriores do próprio lote são feitas em paralelo; apenas os pontos
+     * com vizinho anterior no lote passam por uma resolução sequencial, que
+     * mantém a mesma semântica de chamar addPoint em ordem.
+     *
+     * @param points Pontos a adicionar
+     * @param skipDuplicateCheck true para entrada confiável (sem verificação)
+     * @return Quantidade de pontos efetivamente adicionados
+     */
+    size_t addPoints(const std::vector<Point>& points, bool skipDuplicateCheck = false) {
+        checkAppendable();
+        reserve(m_coords.size() + points.size());
+        m_matrixReady = false;
+
+        if (skipDuplicateCheck || !dedupEnabled()) {
+            for (const auto& p : points) append(p);
+            return points.size();
+        }
+
+        syncGrid();
+        const size_t n = points.size();
+
+        // Grade local do lote, para comparar cada ponto com os anteriores
+        SpatialHashGrid batchGrid;
+        batchGrid.reset(m_duplicateTolerance);
+        batchGrid.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            batchGrid.insert(static_cast<uint32_t>(i), points[i].getX(), points[i].getY());
+        }
+
+        auto nearInBatch = [&](size_t a, size_t b) {
+            return std::abs(points[a].getX() - points[b].getX()) < m_duplicateTolerance &&
+                   std::abs(points[a].getY() - points[b].getY()) < m_duplicateTolerance;
+        };
+
+        // 0 = novo, 1 = duplicado de ponto existente, 2 = tem vizinho anterior no lote
+        std::vector<uint8_t> state(n, 0);
+        auto classify = [&](size_t begin, size_t end) {
+            for (size_t j = begin; j < end; ++j) {
+                double x = points[j].getX(), y = points[j].getY();
+                if (existsNear(x, y)) {
+                    state[j] = 1;
+                } else if (batchGrid.forEachNear(x, y, [&](uint32_t i) {
+                               return i < j && nearInBatch(i, j); })) {
+                    state[j] = 2;
+                }
+            }
+        };
+
+        unsigned threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0 || n < 4096) threadCount = 1;
+        if (threadCount == 1) {
+            classify(0, n);
+        } else {
+            std::vector<std::thread> pool;
+            size_t chunk = (n + threadCount - 1) / threadCount;
+            for (unsigned t = 0; t < threadCount; ++t) {
+                size_t begin = t * chunk, end = std::min(n, begin + chunk);
+                if (begin < end) pool.emplace_back(classify, begin, end);
+            }
+            for (auto& th : pool) th.join();
+        }
+
+        std::vector<uint8_t> kept(n, 0);
+        size_t added = 0;
+        for (size_t j = 0; j < n; ++j) {
+            if (state[j] == 1) continue;
+            if (state[j] == 2) {
+                double x = points[j].getX(), y = points[j].getY();
+                bool duplicate = batchGrid.forEachNear(x, y, [&](uint32_t i) {
+                    return i < j && kept[i] && nearInBatch(i, j); });
+                if (duplicate) continue;
+            }
+            kept[j] = 1;
+            append(points[j]);
+            ++added;
+        }
+        return added;
+    }
+
+    /**
+     * @brief Substitui todos os pontos de uma vez, sem verificar duplicatas
+     *
+     * Para carregadores de arquivos (ex.: TSPLIB), que já montam os arrays
+     * no formato interno: os vetores são movidos, sem cópia nem Point
+     * intermediário. nameIds indexa a tabela names.
+     */
+    void assignPoints(AlignedVector<double> x, AlignedVector<double> y,
+                      std::vector<uint32_t> nameIds, StringTable names) {
+        if (x.size() != y.size() || x.size() != nameIds.size()) {
+            throw TSPException("Coordinate and name arrays differ in size");
+        }
+        clear();
+        m_coords.assign(std::move(x), std::move(y));
+        m_nameIds = std::move(nameIds);
+        m_names = std::move(names);
+    }
+
+    /**
+     * @brief Define a matriz de distâncias explícita (n x n, row-major)
+     *
+     * Passa a métrica para Explicit; o grafo não aceita mais novos pontos.
+     */
+    void setExplicitDistances(std::vector<double> cells) {
+        if (cells.size() != m_coords.size() * m_coords.size()) {
+            throw TSPException("Explicit distance matrix must be n x n");
+        }
+        m_explicit = std::move(cells);
+        m_matrixConfig.metric = DistanceMetric::Explicit;
+        m_matrix.clear();
+        m_matrixReady = false;
+    }
+
+    bool hasExplicitDistances() const { return !m_explicit.empty(); }
+
+    /**
+     * @brief Substitui os pontos por dados externos, sem cópia
+     *
+     * Coordenadas e vizinhos são lidos direto da memória de data.owner; os
+     * nomes só são montados no primeiro getName/getPoint. A métrica de
+     * distância passa a ser data.metric (Explicit não é aceita).
+     */
+    void attachMapped(MappedPoints data) {
+        if (data.metric == DistanceMetric::Explicit) {
+            throw TSPException("Mapped points cannot use explicit distances");
+        }
+        clear();
+        m_coords.attach(data.owner, data.x, data.y, data.count);
+        m_matrixConfig.metric = data.metric;
+        m_mapped = std::move(data);
+        m_namesPending = true;
+    }
+
+    /// true se os pontos ainda são lidos da memória externa
+    bool isMapped() const { return m_coords.isExternal(); }
+
+    /**
+     * @brief Listas de k vizinhos guardadas com os pontos (attachMapped)
+     *
+     * Nulo se não houver listas, se os pontos mudaram ou se a métrica atual
+     * não é a usada para calculá-las.
+     */
+    const uint32_t* getStoredNeighbors() const {
+        return m_mapped.metric == m_matrixConfig.metric ? m_mapped.neighbors : nullptr;
+    }
+    size_t getStoredNeighborCount() const { return getStoredNeighbors() ? m_mapped.neighborCount : 0; }
+
+    void reserve(size_t count) {
+        detachMapped();
+        m_coords.reserve(count);
+        m_nameIds.reserve(count);
+        m_matrixReady = false;
+    }
+
+    /**
+     * @brief Reordena os pontos segundo uma permutação
+     *
+     * Depois da chamada o ponto i é o antigo ponto order[i]. Coordenadas,
+     * ids de nome e ids originais são permutados; a grade de duplicatas e a
+     * matriz de distâncias são reconstruídas sob demanda. Rotas calculadas
+     * antes da reordenação deixam de valer.
+     */
+    void reorderPoints(const std::vector<uint32_t>& order) {
+        const size_t n = m_coords.size();
+        if (order.size() != n) throw TSPException("Invalid permutation");
+        std::vector<uint8_t> seen(n, 0);
+        for (uint32_t index : order) {
+            if (index >= n || seen[index]) throw TSPException("Invalid permutation");
+            seen[index] = 1;
+        }
+
+        ensureNames();
+        AlignedVector<double> x(n), y(n);
+        std::vector<uint32_t> nameIds(n), originalIds(n);
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = m_coords.x(order[i]);
+            y[i] = m_coords.y(order[i]);
+            nameIds[i] = m_nameIds[order[i]];
+            originalIds[i] = getOriginalId(order[i]);
+        }
+        m_coords.assign(std::move(x), std::move(y));
+        m_mapped = MappedPoints();
+        m_nameIds.swap(nameIds);
+        m_originalIds.swap(originalIds);
+        if (!m_explicit.empty()) {
+            std::vector<double> cells(n * n);
+            for (size_t i = 0; i < n; ++i) {
+                const double* row = m_explicit.data() + size_t(order[i]) * n;
+                for (size_t j = 0; j < n; ++j) cells[i * n + j] = row[order[j]];
+            }
+            m_explicit.swap(cells);
+        }
+        m_gridSize = 0;
+        m_matrix.clear();
+        m_matrixReady = false;
+    }
+
+    /**
+     * @brief Ordem de Hilbert dos pontos (ver SpaceFillingCurve)
+     * @param threads Threads usadas (0 = hardware_concurrency())
+     */
+    std::vector<uint32_t> hilbertOrder(unsigned threads = 0) const {
+        ThreadPool pool(threads);
+        return SpaceFillingCurve::hilbertOrder(m_coords.xData(), m_coords.yData(), m_coords.size(), pool);
+    }
+
+    /**
+     * @brief Renumera os pontos na ordem de uma curva de preenchimento
+     *
+     * Chamar depois de carregar os pontos e antes de resolver. Nomes e
+     * coordenadas acompanham os pontos; use getOriginalId (ou
+     * Route::getOriginalSequence) para exportar na numeração original.
+     *
+     * @param curve Hilbert (melhor localidade) ou Morton
+     * @param threads Threads usadas (0 = hardware_concurrency())
+     */
+    void renumber(SpaceFillingCurve::Curve curve = SpaceFillingCurve::Curve::Hilbert,
+                  unsigned threads = 0) {
+        if (m_coords.size() < 2) return;
+        ThreadPool pool(threads);
+        reorderPoints(SpaceFillingCurve::curveOrder(m_coords.xData(), m_coords.yData(), m_coords.size(),
+                                                    pool, curve));
+    }
+
+    /// Índice do ponto na ordem de inserção (antes de qualquer renumeração)
+    uint32_t getOriginalId(size_t index) const {
+        return m_originalIds.empty() ? static_cast<uint32_t>(index) : m_originalIds[index];
+    }
+
+    /// true se os pontos já foram reordenados
+    bool isRenumbered() const { return !m_originalIds.empty(); }
+
+    /**
+     * @brief Visão materializada do ponto (cópia com nome)
+     */
+    Point getPoint(size_t index) const {
+        checkIndex(index);
+        ensureNames();
+        return Point(m_coords.x(index), m_coords.y(index), m_names[m_nameIds[index]]);
+    }
+
+    // Acesso direto às coordenadas (sem verificação de limites)
+    double getX(size_t index) const { return m_coords.x(index); }
+    double getY(size_t index) const { return m_coords.y(index); }
+    const double* xData() const { return m_coords.xData(); }
+    const double* yData() const { return m_coords.yData(); }
+
+    const std::string& getName(size_t index) const {
+        checkIndex(index);
+        ensureNames();
+        return m_names[m_nameIds[index]];
+    }
+    const StringTable& getNameTable() const {
+        ensureNames();
+        return m_names;
+    }
+
+    size_t size() const { return m_coords.size(); }
+    size_t getSize() const { return m_coords.size(); }
+    bool empty() const { return m_coords.empty(); }
+
+    std::vector<Point> getAllPoints() const {
+        std::vector<Point> points;
+        ensureNames();
+        points.reserve(m_coords.size());
+        for (size_t i = 0; i < m_coords.size(); ++i) {
+            points.emplace_back(m_coords.x(i), m_coords.y(i), m_names[m_nameIds[i]]);
+        }
+        return points;
+    }
+
+    void clear() {
+        m_coords.clear();
+        m_mapped = MappedPoints();
+        m_namesPending = false;
+        m_nameIds.clear();
+        m_originalIds.clear();
+        m_names.clear();
+        if (!m_explicit.empty()) {
+            m_explicit.clear();
+            m_matrixConfig.metric = DistanceMetric::Euclidean;
+        }
+        m_grid.reset(m_duplicateTolerance);
+        m_gridSize = 0;
+        m_matrix.clear();
+        m_matrixReady = false;
+    }
+
+    /**
+     * @brief Define a tolerância usada para detectar pontos duplicados
+     *
+     * Dois pontos são duplicados se diferem menos que a tolerância em cada
+     * eixo. Tolerância <= 0 desativa a verificação.
+     */
+    void setDuplicateTolerance(double tolerance) {
+        m_duplicateTolerance = tolerance;
+        m_gridSize = 0;
+    }
+    double getDuplicateTolerance() const { return m_duplicateTolerance; }
+
+    /**
+     * @brief Configuração da matriz, incluindo a métrica (ex.: TSPLIB EUC_2D)
+     *
+     * A métrica Explicit só é definida por setExplicitDistances.
+     */
+    void setDistanceConfig(const DistanceMatrix::Config& config) {
+        if ((config.metric == DistanceMetric::Explicit) != !m_explicit.empty()) {
+            throw TSPException("Explicit metric requires explicit distances");
+        }
+        m_matrixConfig = config;
+        m_matrixReady = false;
+    }
+    const DistanceMatrix::Config& getDistanceConfig() const { return m_matrixConfig; }
+
+    /**
+     * @brief Matriz de distâncias, construída sob demanda uma vez por grafo
+     */
+    const DistanceMatrix& getDistanceMatrix() const {
+        // No modo OnTheFly a matriz lê m_coords: uma cópia do grafo reconstrói (sem custo)
+        if (!m_matrixReady || !m_matrix.readsFrom(m_coords.xData())) {
+            if (m_explicit.empty()) {
+                m_matrix.build(m_coords.xData(), m_coords.yData(), m_coords.size(), m_matrixConfig);
+            } else {
+                m_matrix.buildExplicit(m_explicit.data(), m_coords.size());
+            }
+            m_matrixReady = true;
+        }
+        return m_matrix;
+    }
+
+    double getDistance(size_t from, size_t to) const {
+        checkIndex(from);
+        checkIndex(to);
+        return getDistanceMatrix().at(from, to);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const Graph& g) {
+        return os << "Graph[" << g.m_coords.size() << " points]";
+    }
+};
+
+#endif // GRAPH_H
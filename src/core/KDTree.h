@@ -0,0 +1,291 @@
+#ifndef KDTREE_H
+#define KDTREE_H
+
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <utility>
+
+#include "core/Graph.h"
+
+/**
+ * @brief Índice espacial 2-D estático (k-d tree) sobre as coordenadas do Graph
+ *
+ * A árvore é construída uma vez (O(n log n)) e suporta remoção e
+ * reinserção de pontos (marcação + contagem de vivos por nó, para podar
+ * subárvores vazias),
+ * consulta do vizinho mais próximo e dos k vizinhos mais próximos.
+ * Empates de distância são resolvidos pelo menor índice, reproduzindo a
+ * varredura linear.
+ *
+ * As coordenadas são copiadas na ordem das folhas para melhor localidade;
+ * o Graph pode ser alterado depois sem invalidar o índice.
+ */
+class KDTree {
+public:
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+    /// Par (distância, índice do ponto) retornado pelas consultas k-NN
+    using Neighbor = std::pair<double, uint32_t>;
+
+private:
+    static constexpr uint32_t LEAF_SIZE = 8;
+
+    struct Node {
+        double minX, minY, maxX, maxY;
+        uint32_t begin, end;      ///< Intervalo em m_perm
+        uint32_t left, right;     ///< Filhos (npos em folhas)
+        uint32_t parent;
+        uint32_t alive;           ///< Pontos vivos na subárvore
+    };
+
+    std::vector<Node> m_nodes;
+    std::vector<uint32_t> m_perm;      ///< Posição -> índice do ponto
+    std::vector<double> m_px, m_py;    ///< Coordenadas na ordem de m_perm
+    std::vector<uint32_t> m_posOf;     ///< Índice do ponto -> posição
+    std::vector<uint32_t> m_leafOf;    ///< Índice do ponto -> folha
+    std::vector<uint8_t> m_alive;      ///< Por posição
+    size_t m_aliveCount;
+
+    uint32_t build(const double* xs, const double* ys,
+                   uint32_t begin, uint32_t end, uint32_t parent) {
+        Node node;
+        node.minX = node.minY = std::numeric_limits<double>::max();
+        node.maxX = node.maxY = std::numeric_limits<double>::lowest();
+        for (uint32_t i = begin; i < end; ++i) {
+            uint32_t p = m_perm[i];
+            node.minX = std::min(node.minX, xs[p]);
+            node.maxX = std::max(node.maxX, xs[p]);
+            node.minY = std::min(node.minY, ys[p]);
+            node.maxY = std::max(node.maxY, ys[p]);
+        }
+        node.begin = begin;
+        node.end = end;
+        node.left = node.right = npos;
+        node.parent = parent;
+        node.alive = end - begin;
+
+        uint32_t id = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.push_back(node);
+
+        if (end - begin <= LEAF_SIZE) {
+            for (uint32_t i = begin; i < end; ++i) m_leafOf[m_perm[i]] = id;
+            return id;
+        }
+
+        // Divide pela dimensão de maior extensão, na mediana
+        bool splitX = (node.maxX - node.minX) >= (node.maxY - node.minY);
+        uint32_t mid = begin + (end - begin) / 2;
+        const double* key = splitX ? xs : ys;
+        std::nth_element(m_perm.begin() + begin, m_perm.begin() + mid, m_perm.begin() + end,
+                         [key](uint32_t a, uint32_t b) { return key[a] < key[b]; });
+
+        uint32_t left = build(xs, ys, begin, mid, id);
+        uint32_t right = build(xs, ys, mid, end, id);
+        m_nodes[id].left = left;
+        m_nodes[id].right = right;
+        return id;
+    }
+
+    double boxDistance(const Node& node, double x, double y) const {
+        double dx = 0.0, dy = 0.0;
+        if (x < node.minX) dx = node.minX - x;
+        else if (x > node.maxX) dx = x - node.maxX;
+        if (y < node.minY) dy = node.minY - y;
+        else if (y > node.maxY) dy = y - node.maxY;
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    static bool closer(double d1, uint32_t i1, double d2, uint32_t i2) {
+        return d1 < d2 || (d1 == d2 && i1 < i2);
+    }
+
+    void nearestIn(uint32_t nodeId, double x, double y, uint32_t exclude,
+                   double& bestDist, uint32_t& bestIndex) const {
+        const Node& node = m_nodes[nodeId];
+        if (node.alive == 0 || boxDistance(node, x, y) > bestDist) return;
+
+        if (node.left == npos) {
+            for (uint32_t i = node.begin; i < node.end; ++i) {
+                if (!m_alive[i] || m_perm[i] == exclude) continue;
+                double dx = m_px[i] - x;
+                double dy = m_py[i] - y;
+                double d = std::sqrt(dx * dx + dy * dy);
+                if (closer(d, m_perm[i], bestDist, bestIndex)) {
+                    bestDist = d;
+                    bestIndex = m_perm[i];
+                }
+            }
+            return;
+        }
+
+        uint32_t first = node.left, second = node.right;
+        if (boxDistance(m_nodes[second], x, y) < boxDistance(m_nodes[first], x, y)) {
+            std::swap(first, second);
+        }
+        nearestIn(first, x, y, exclude, bestDist, bestIndex);
+        nearestIn(second, x, y, exclude, bestDist, bestIndex);
+    }
+
+    void kNearestIn(uint32_t nodeId, double x, double y, uint32_t exclude, size_t k,
+                    std::vector<Neighbor>& heap) const {
+        const Node& node = m_nodes[nodeId];
+        if (node.alive == 0) return;
+        if (heap.size() == k && boxDistance(node, x, y) > heap.front().first) return;
+
+        auto cmp = [](const Neighbor& a, const Neighbor& b) {
+            return closer(a.first, a.second, b.first, b.second);
+        };
+
+        if (node.left == npos) {
+            for (uint32_t i = node.begin; i < node.end; ++i) {
+                if (!m_alive[i] || m_perm[i] == exclude) continue;
+                double dx = m_px[i] - x;
+                double dy = m_py[i] - y;
+                Neighbor candidate(std::sqrt(dx * dx + dy * dy), m_perm[i]);
+                if (heap.size() < k) {
+                    heap.push_back(candidate);
+                    std::push_heap(heap.begin(), heap.end(), cmp);
+                } else if (cmp(candidate, heap.front())) {
+                    std::pop_heap(heap.begin(), heap.end(), cmp);
+                    heap.back() = candidate;
+                    std::push_heap(heap.begin(), heap.end(), cmp);
+                }
+            }
+            return;
+        }
+
+        uint32_t first = node.left, second = node.right;
+        if (boxDistance(m_nodes[second], x, y) < boxDistance(m_nodes[first], x, y)) {
+            std::swap(first, second);
+        }
+        kNearestIn(first, x, y, exclude, k, heap);
+        kNearestIn(second, x, y, exclude, k, heap);
+    }
+
+public:
+    KDTree() : m_aliveCount(0) {}
+
+    explicit KDTree(const Graph& graph) : m_aliveCount(0) {
+        build(graph.xData(), graph.yData(), graph.size());
+    }
+
+    /**
+     * @brief Constrói o índice sobre arrays de coordenadas
+     */
+    void build(const double* xs, const double* ys, size_t n) {
+        m_nodes.clear();
+        m_perm.resize(n);
+        m_posOf.resize(n);
+        m_leafOf.resize(n);
+        for (size_t i = 0; i < n; ++i) m_perm[i] = static_cast<uint32_t>(i);
+        if (n > 0) {
+            m_nodes.reserve(2 * (n / LEAF_SIZE + 1));
+            build(xs, ys, 0, static_cast<uint32_t>(n), npos);
+        }
+
+        m_px.resize(n);
+        m_py.resize(n);
+        for (size_t pos = 0; pos < n; ++pos) {
+            uint32_t p = m_perm[pos];
+            m_px[pos] = xs[p];
+            m_py[pos] = ys[p];
+            m_posOf[p] = static_cast<uint32_t>(pos);
+        }
+        m_alive.assign(n, 1);
+        m_aliveCount = n;
+    }
+
+    /**
+     * @brief Restaura todos os pontos removidos
+     */
+    void reset() {
+        std::fill(m_alive.begin(), m_alive.end(), 1);
+        for (auto& node : m_nodes) node.alive = node.end - node.begin;
+        m_aliveCount = m_perm.size();
+    }
+
+    /**
+     * @brief Remove um ponto das consultas seguintes (O(log n))
+     * @return false se o ponto já havia sido removido
+     */
+    bool remove(uint32_t index) {
+        uint32_t pos = m_posOf[index];
+        if (!m_alive[pos]) return false;
+        m_alive[pos] = 0;
+        --m_aliveCount;
+        for (uint32_t node = m_leafOf[index]; node != npos; node = m_nodes[node].parent) {
+            --m_nodes[node].alive;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Devolve às consultas um ponto removido (O(log n))
+     * @return false se o ponto já estava presente
+     */
+    bool restore(uint32_t index) {
+        uint32_t pos = m_posOf[index];
+        if (m_alive[pos]) return false;
+        m_alive[pos] = 1;
+        ++m_aliveCount;
+        for (uint32_t node = m_leafOf[index]; node != npos; node = m_nodes[node].parent) {
+            ++m_nodes[node].alive;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Remove todos os pontos, para um índice que começa vazio e
+     *        recebe pontos com restore
+     */
+    void removeAll() {
+        std::fill(m_alive.begin(), m_alive.end(), 0);
+        for (auto& node : m_nodes) node.alive = 0;
+        m_aliveCount = 0;
+    }
+
+    bool contains(uint32_t index) const { return m_alive[m_posOf[index]] != 0; }
+
+    /**
+     * @brief Ponto vivo mais próximo de (x, y), ou npos se não houver
+     * @param exclude Índice a ignorar (por exemplo, o próprio ponto consultado)
+     */
+    uint32_t nearest(double x, double y, uint32_t exclude = npos) const {
+        double bestDist = std::numeric_limits<double>::infinity();
+        uint32_t bestIndex = npos;
+        if (!m_nodes.empty()) nearestIn(0, x, y, exclude, bestDist, bestIndex);
+        return bestIndex;
+    }
+
+    /**
+     * @brief Os k pontos vivos mais próximos de (x, y), em ordem crescente
+     */
+    std::vector<Neighbor> kNearest(double x, double y, size_t k,
+                                   uint32_t exclude = npos) const {
+        std::vector<Neighbor> heap;
+        if (k == 0 || m_nodes.empty()) return heap;
+        heap.reserve(k);
+        kNearestIn(0, x, y, exclude, k, heap);
+        std::sort(heap.begin(), heap.end(), [](const Neighbor& a, const Neighbor& b) {
+            return closer(a.first, a.second, b.first, b.second);
+        });
+        return heap;
+    }
+
+    /**
+     * @brief Os k vizinhos mais próximos de um ponto do índice (excluindo ele mesmo)
+     */
+    std::vector<Neighbor> kNearest(uint32_t index, size_t k) const {
+        uint32_t pos = m_posOf[index];
+        return kNearest(m_px[pos], m_py[pos], k, index);
+    }
+
+    size_t size() const { return m_perm.size(); }
+    size_t aliveCount() const { return m_aliveCount; }
+    bool empty() const { return m_aliveCount == 0; }
+};
+
+#endif // KDTREE_H
@@ -0,0 +1,219 @@
+#ifndef MINIMUMSPANNINGTREE_H
+#define MINIMUMSPANNINGTREE_H
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+#include "core/Graph.h"
+#include "core/CandidateLists.h"
+#include "core/KDTree.h"
+#include "core/DisjointSets.h"
+#include "core/RadixSort.h"
+#include "core/ThreadPool.h"
+
+/**
+ * @brief Árvore geradora mínima euclidiana a partir do grafo dos k vizinhos
+ *
+ * Em vez do grafo completo (O(n²) arestas), Kruskal roda sobre as arestas
+ * das listas de candidatos, ordenadas pelo radix sort paralelo. A árvore
+ * euclidiana mínima está contida na triangulação de Delaunay, cujos
+ * vértices têm em média 6 vizinhos, então com k ≈ 10 o grafo dos vizinhos
+ * quase sempre a contém. Se o grafo dos vizinhos for desconexo (clusters
+ * distantes), as componentes são ligadas por rodadas de Borůvka: a aresta
+ * mínima que sai de cada componente é achada no KDTree, removendo a
+ * própria componente antes das consultas. Com GEO ou matriz explícita,
+ * cujas distâncias não seguem as coordenadas, a aresta é achada varrendo
+ * a matriz (O(n²) por rodada).
+ *
+ * O peso da árvore é um limite inferior para a rota ótima (tirar uma aresta
+ * da rota dá uma árvore geradora), válido quando a árvore é a mínima
+ * exata, o que só falha se alguma aresta da árvore euclidiana mínima
+ * ficar fora das listas de candidatos.
+ */
+class MinimumSpanningTree {
+public:
+    struct Edge {
+        uint32_t a;
+        uint32_t b;
+        double length;
+    };
+
+private:
+    std::vector<Edge> m_edges;
+    std::vector<uint32_t> m_offset;      ///< CSR da adjacência
+    std::vector<uint32_t> m_neighbors;
+    double m_weight = 0.0;
+
+    void connectComponents(const Graph& graph, DisjointSets& sets) {
+        const uint32_t n = static_cast<uint32_t>(graph.size());
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        const bool spatial = followsCoordinates(graph.getDistanceConfig().metric);
+        KDTree index;
+        if (spatial) index.build(graph.xData(), graph.yData(), n);
+
+        while (sets.count() > 1) {
+            // Vértices agrupados por componente
+            std::vector<uint32_t> root(n), order(n);
+            for (uint32_t v = 0; v < n; ++v) {
+                root[v] = sets.find(v);
+                order[v] = v;
+            }
+            std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+                return root[a] < root[b] || (root[a] == root[b] && a < b);
+            });
+
+            std::vector<Edge> shortest;
+            for (size_t begin = 0; begin < n;) {
+                size_t end = begin;
+                while (end < n && root[order[end]] == root[order[begin]]) ++end;
+
+                Edge best{0, 0, std::numeric_limits<double>::infinity()};
+                if (spatial) {
+                    for (size_t i = begin; i < end; ++i) index.remove(order[i]);
+                    for (size_t i = begin; i < end; ++i) {
+                        uint32_t v = order[i];
+                        uint32_t u = index.nearest(graph.getX(v), graph.getY(v));
+                        double d = dist.at(v, u);
+                        if (d < best.length) best = {v, u, d};
+                    }
+                    for (size_t i = begin; i < end; ++i) index.restore(order[i]);
+                } else {
+                    for (size_t i = begin; i < end; ++i) {
+                        uint32_t v = order[i];
+                        for (uint32_t u = 0; u < n; ++u) {
+                            if (root[u] == root[v]) continue;
+                            double d = dist.at(v, u);
+                            if (d < best.length) best = {v, u, d};
+                        }
+                    }
+                }
+
+                shortest.push_back(best);
+                begin = end;
+            }
+
+            for (const Edge& edge : shortest) {
+                if (sets.unite(edge.a, edge.b)) m_edges.push_back(edge);
+            }
+        }
+    }
+
+public:
+    MinimumSpanningTree() = default;
+
+    /**
+     * @param graph Pontos
+     * @param k Vizinhos por cidade usados como arestas candidatas
+     * @param threads Threads (0 = hardware_concurrency())
+     */
+    MinimumSpanningTree(const Graph& graph, size_t k = 10, unsigned threads = 0) {
+        build(graph, k, threads);
+    }
+
+    void build(const Graph& graph, size_t k = 10, unsigned threads = 0) {
+        CandidateLists candidates(graph, k, threads);
+        build(graph, candidates, threads);
+    }
+
+    /**
+     * @brief Constrói a árvore reaproveitando listas de candidatos existentes
+     */
+    void build(const Graph& graph, const CandidateLists& candidates, unsigned threads = 0) {
+        const size_t n = graph.size();
+        const size_t k = candidates.k();
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        m_edges.clear();
+        m_weight = 0.0;
+
+        std::vector<Edge> edges;
+        edges.reserve(n * k);
+        for (uint32_t i = 0; i < n; ++i) {
+            const uint32_t* row = candidates.of(i);
+            for (size_t t = 0; t < k; ++t) {
+                uint32_t j = row[t];
+                if (j < i) {
+                    const uint32_t* back = candidates.of(j);
+                    if (std::find(back, back + k, i) != back + k) continue;
+                }
+                edges.push_back({i, j, 0.0});
+            }
+        }
+
+        // Comprimentos em float como chave do radix sort (bits na mesma ordem)
+        ThreadPool pool(threads);
+        RadixSort::Items items(edges.size());
+        pool.parallelFor(edges.size(), [&](size_t e, unsigned) {
+            edges[e].length = dist.at(edges[e].a, edges[e].b);
+            float length = static_cast<float>(edges[e].length);
+            uint32_t bits;
+            std::memcpy(&bits, &length, sizeof(bits));
+            items[e] = RadixSort::pack(bits, static_cast<uint32_t>(e));
+        });
+        RadixSort::sortByKey(items, pool);
+
+        DisjointSets sets(n);
+        m_edges.reserve(n > 0 ? n - 1 : 0);
+        for (uint64_t item : items) {
+            const Edge& edge = edges[RadixSort::valueOf(item)];
+            if (sets.unite(edge.a, edge.b)) {
+                m_edges.push_back(edge);
+                if (sets.count() == 1) break;
+            }
+        }
+        if (n > 1 && sets.count() > 1) connectComponents(graph, sets);
+
+        m_offset.assign(n + 1, 0);
+        for (const Edge& edge : m_edges) {
+            ++m_offset[edge.a + 1];
+            ++m_offset[edge.b + 1];
+            m_weight += edge.length;
+        }
+        for (size_t i = 0; i < n; ++i) m_offset[i + 1] += m_offset[i];
+        m_neighbors.resize(2 * m_edges.size());
+        std::vector<uint32_t> fill(m_offset.begin(), m_offset.end() - 1);
+        for (const Edge& edge : m_edges) {
+            m_neighbors[fill[edge.a]++] = edge.b;
+            m_neighbors[fill[edge.b]++] = edge.a;
+        }
+    }
+
+    const std::vector<Edge>& edges() const { return m_edges; }
+
+    /// Soma dos comprimentos das arestas (limite inferior da rota ótima)
+    double getWeight() const { return m_weight; }
+
+    size_t size() const { return m_offset.empty() ? 0 : m_offset.size() - 1; }
+    size_t degree(uint32_t v) const { return m_offset[v + 1] - m_offset[v]; }
+    const uint32_t* neighborsBegin(uint32_t v) const { return m_neighbors.data() + m_offset[v]; }
+    const uint32_t* neighborsEnd(uint32_t v) const { return m_neighbors.data() + m_offset[v + 1]; }
+
+    /**
+     * @brief Vértices em pré-ordem de uma busca em profundidade (iterativa)
+     */
+    std::vector<uint32_t> preorder(uint32_t root = 0) const {
+        std::vector<uint32_t> order;
+        order.reserve(size());
+        std::vector<uint8_t> seen(size(), 0);
+        std::vector<uint32_t> stack{root};
+        seen[root] = 1;
+        while (!stack.empty()) {
+            uint32_t v = stack.back();
+            stack.pop_back();
+            order.push_back(v);
+            // Empilhados em ordem inversa para visitar na ordem da adjacência
+            for (const uint32_t* it = neighborsEnd(v); it != neighborsBegin(v);) {
+                uint32_t u = *--it;
+                if (!seen[u]) {
+                    seen[u] = 1;
+                    stack.push_back(u);
+                }
+            }
+        }
+        return order;
+    }
+};
+
+#endif // MINIMUMSPANNINGTREE_H
@@ -0,0 +1,63 @@
+#ifndef POINT_H
+#define POINT_H
+
+#include <iostream>
+#include <string>
+#include <cmath>
+
+/**
+ * @brief Classe que representa um ponto/cidade no problema TSP
+ * 
+ * No Graph os pontos são armazenados como arrays de coordenadas; Point é
+ * usado como valor de entrada e como visão materializada para a GUI e
+ * para impressão.
+ * 
+ * Demonstra conceitos POO:
+ * - Encapsulamento: dados privados com interface pública
+ * - Sobrecarga de operadores
+ * - Métodos const
+ */
+class Point {
+private:
+    double m_x, m_y;
+    std::string m_name;
+
+public:
+    Point(double x = 0, double y = 0, const std::string& name = "") 
+        : m_x(x), m_y(y), m_name(name) {}
+    
+    // Getters
+    double getX() const { return m_x; }
+    double getY() const { return m_y; }
+    const std::string& getName() const { return m_name; }
+    
+    // Setters
+    void setX(double x) { m_x = x; }
+    void setY(double y) { m_y = y; }
+    void setName(const std::string& name) { m_name = name; }
+    
+    // Operações
+    double distanceTo(const Point& other) const {
+        double dx = m_x - other.m_x;
+        double dy = m_y - other.m_y;
+        return std::sqrt(dx * dx + dy * dy);
+    }
+    
+    // Sobrecarga de operadores
+    bool operator==(const Point& other) const {
+        const double EPSILON = 1e-9;
+        return std::abs(m_x - other.m_x) < EPSILON && 
+               std::abs(m_y - other.m_y) < EPSILON;
+    }
+    
+    bool operator<(const Point& other) const {
+        if (std::abs(m_x - other.m_x) > 1e-9) return m_x < other.m_x;
+        return m_y < other.m_y;
+    }
+    
+    friend std::ostream& operator<<(std::ostream& os, const Point& p) {
+        return os << "Point(" << p.m_x << ", " << p.m_y << ", \"" << p.m_name << "\")";
+    }
+};
+
+#endif // POINT_H
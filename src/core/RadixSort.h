@@ -0,0 +1,95 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+#include <vector>
+#include <array>
+#include <cstdint>
+#include <algorithm>
+
+#include "core/AlignedAllocator.h"
+#include "core/ThreadPool.h"
+
+/**
+ * @brief Radix sort LSD paralelo para pares (chave, valor) empacotados
+ *
+ * Cada item é um uint64_t com a chave nos 32 bits altos e o valor (em
+ * geral o índice do ponto) nos 32 bits baixos. A ordenação usa dígitos de
+ * 8 bits: em cada passada os blocos da entrada montam histogramas em
+ * paralelo, os deslocamentos são somados por (dígito, bloco) e os itens
+ * são espalhados em paralelo para o buffer auxiliar. Como a ordem relativa
+ * dentro de cada bloco é preservada, a ordenação é estável. Passadas em que
+ * todos os itens têm o mesmo dígito são puladas.
+ */
+class RadixSort {
+public:
+    using Items = AlignedVector<uint64_t>;
+
+    static uint64_t pack(uint32_t key, uint32_t value) {
+        return (uint64_t(key) << 32) | value;
+    }
+    static uint32_t keyOf(uint64_t item) { return static_cast<uint32_t>(item >> 32); }
+    static uint32_t valueOf(uint64_t item) { return static_cast<uint32_t>(item); }
+
+    /**
+     * @brief Ordena items pelos keyBits bits menos significativos da chave
+     * @param items Itens empacotados com pack()
+     * @param pool Threads usadas nas passadas (a chamadora participa)
+     * @param keyBits Bits úteis da chave (1 a 32)
+     */
+    static void sortByKey(Items& items, ThreadPool& pool, unsigned keyBits = 32) {
+        const size_t n = items.size();
+        if (n < 2) return;
+
+        // Blocos grandes o bastante para amortizar os histogramas
+        const size_t blocks = std::max<size_t>(1, std::min<size_t>(pool.size() * 4, n / 65536));
+        const size_t blockSize = (n + blocks - 1) / blocks;
+        std::vector<std::array<size_t, RADIX>> counts(blocks);
+
+        Items scratch(n);
+        uint64_t* source = items.data();
+        uint64_t* target = scratch.data();
+
+        for (unsigned shift = 32; shift < 32 + keyBits; shift += DIGIT_BITS) {
+            pool.parallelFor(blocks, [&](size_t b, unsigned) {
+                auto& count = counts[b];
+                count.fill(0);
+                size_t end = std::min(n, (b + 1) * blockSize);
+                for (size_t i = b * blockSize; i < end; ++i) ++count[(source[i] >> shift) & MASK];
+            });
+
+            // Deslocamento de cada (dígito, bloco) em ordem de dígito e de bloco
+            size_t offset = 0;
+            bool singleDigit = false;
+            for (size_t digit = 0; digit < RADIX; ++digit) {
+                size_t total = 0;
+                for (size_t b = 0; b < blocks; ++b) {
+                    size_t count = counts[b][digit];
+                    counts[b][digit] = offset + total;
+                    total += count;
+                }
+                if (total == n) singleDigit = true;
+                offset += total;
+            }
+            if (singleDigit) continue;
+
+            pool.parallelFor(blocks, [&](size_t b, unsigned) {
+                auto& position = counts[b];
+                size_t end = std::min(n, (b + 1) * blockSize);
+                for (size_t i = b * blockSize; i < end; ++i) {
+                    uint64_t item = source[i];
+                    target[position[(item >> shift) & MASK]++] = item;
+                }
+            });
+            std::swap(source, target);
+        }
+
+        if (source != items.data()) items.swap(scratch);
+    }
+
+private:
+    static constexpr unsigned DIGIT_BITS = 8;
+    static constexpr size_t RADIX = size_t(1) << DIGIT_BITS;
+    static constexpr uint64_t MASK = RADIX - 1;
+};
+
+#endif // RADIXSORT_H
@@ -0,0 +1,224 @@
+#ifndef ROUTE_H
+#define ROUTE_H
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+#include "core/Graph.h"
+#include "core/TSPException.h"
+
+/**
+ * @brief Classe que representa uma rota/solução TSP
+ *
+ * A rota é uma permutação de índices (uint32_t) para os pontos de um Graph.
+ * O comprimento é mantido incrementalmente em addPoint, insertPoint e
+ * removePoint (O(1) cada) e recalculado de forma preguiçosa apenas quando a
+ * sequência é substituída por inteiro. Pontos só são materializados quando
+ * solicitados explicitamente (getPoint/getPoints).
+ *
+ * Convenção de distância: com 2 pontos conta-se apenas a aresta entre eles;
+ * a partir de 3 pontos a rota é um ciclo fechado.
+ *
+ * Demonstra conceitos POO:
+ * - Composição: Route referencia o Graph e contém a sequência de índices
+ * - Sobrecarga de operadores
+ * - Cálculos automáticos (incrementais e preguiçosos)
+ */
+class Route {
+private:
+    const Graph* m_graph;
+    std::vector<uint32_t> m_sequence;
+    mutable double m_pathLength;          ///< Caminho aberto (sem a aresta de retorno)
+    mutable bool m_distanceCalculated;
+
+    double dist(uint32_t from, uint32_t to) const {
+        return m_graph->getDistanceMatrix().at(from, to);
+    }
+
+    double closingEdge() const {
+        if (m_sequence.size() < 3) return 0.0;
+        return dist(m_sequence.back(), m_sequence.front());
+    }
+
+    void requireGraph() const {
+        if (!m_graph) throw TSPException("Route is not bound to a graph");
+    }
+
+public:
+    Route() : m_graph(nullptr), m_pathLength(0.0), m_distanceCalculated(true) {}
+
+    explicit Route(const Graph& graph)
+        : m_graph(&graph), m_pathLength(0.0), m_distanceCalculated(true) {}
+
+    Route(const Graph& graph, std::vector<uint32_t> sequence)
+        : m_graph(&graph), m_sequence(std::move(sequence)),
+          m_pathLength(0.0), m_distanceCalculated(false) {}
+
+    const Graph* getGraph() const { return m_graph; }
+
+    void reserve(size_t count) { m_sequence.reserve(count); }
+
+    /**
+     * @brief Adiciona um ponto no final da rota (O(1))
+     * @param index Índice do ponto no Graph
+     */
+    void addPoint(uint32_t index) {
+        requireGraph();
+        if (m_distanceCalculated && !m_sequence.empty()) {
+            m_pathLength += dist(m_sequence.back(), index);
+        }
+        m_sequence.push_back(index);
+    }
+
+    /**
+     * @brief Insere um ponto antes da posição indicada (custo de distância O(1))
+     */
+    void insertPoint(size_t position, uint32_t index) {
+        requireGraph();
+        if (position > m_sequence.size()) throw TSPException("Index out of bounds");
+        if (position == m_sequence.size()) {
+            addPoint(index);
+            return;
+        }
+        if (m_distanceCalculated) {
+            uint32_t next = m_sequence[position];
+            if (position == 0) {
+                m_pathLength += dist(index, next);
+            } else {
+                uint32_t prev = m_sequence[position - 1];
+                m_pathLength += dist(prev, index) + dist(index, next) - dist(prev, next);
+            }
+        }
+        m_sequence.insert(m_sequence.begin() + position, index);
+    }
+
+    /**
+     * @brief Remove o ponto na posição indicada (custo de distância O(1))
+     */
+    void removePoint(size_t position) {
+        if (position >= m_sequence.size()) throw TSPException("Index out of bounds");
+        if (m_distanceCalculated && m_sequence.size() > 1) {
+            uint32_t removed = m_sequence[position];
+            if (position == 0) {
+                m_pathLength -= dist(removed, m_sequence[1]);
+            } else if (position == m_sequence.size() - 1) {
+                m_pathLength -= dist(m_sequence[position - 1], removed);
+            } else {
+                uint32_t prev = m_sequence[position - 1];
+                uint32_t next = m_sequence[position + 1];
+                m_pathLength += dist(prev, next) - dist(prev, removed) - dist(removed, next);
+            }
+        }
+        m_sequence.erase(m_sequence.begin() + position);
+        if (m_sequence.size() < 2) m_pathLength = 0.0;
+    }
+
+    void clear() {
+        m_sequence.clear();
+        m_pathLength = 0.0;
+        m_distanceCalculated = true;
+    }
+
+    /**
+     * @brief Substitui a sequência; o comprimento é recalculado sob demanda
+     */
+    void setSequence(std::vector<uint32_t> sequence) {
+        m_sequence = std::move(sequence);
+        m_distanceCalculated = false;
+    }
+
+    /**
+     * @brief Marca o comprimento como inválido (após edição externa da sequência)
+     */
+    void invalidateDistance() { m_distanceCalculated = false; }
+
+    const std::vector<uint32_t>& getSequence() const { return m_sequence; }
+
+    /**
+     * @brief Sequência na numeração original do Graph (ver Graph::renumber)
+     */
+    std::vector<uint32_t> getOriginalSequence() const {
+        requireGraph();
+        std::vector<uint32_t> ids(m_sequence.size());
+        for (size_t i = 0; i < m_sequence.size(); ++i) ids[i] = m_graph->getOriginalId(m_sequence[i]);
+        return ids;
+    }
+    uint32_t operator[](size_t position) const { return m_sequence[position]; }
+
+    /**
+     * @brief true se a sequência visita cada cidade do Graph exatamente uma vez
+     *
+     * Melhorias que indexam estruturas por cidade (TourArray) exigem isso
+     * da rota inicial; uma rota parcial escreveria fora delas.
+     */
+    bool visitsEveryCity() const {
+        if (!m_graph || m_sequence.size() != m_graph->size()) return false;
+        std::vector<uint8_t> seen(m_sequence.size(), 0);
+        for (uint32_t city : m_sequence) {
+            if (city >= seen.size() || seen[city]) return false;
+            seen[city] = 1;
+        }
+        return true;
+    }
+
+    size_t size() const { return m_sequence.size(); }
+    size_t getSize() const { return m_sequence.size(); }
+    bool empty() const { return m_sequence.empty(); }
+
+    double getTotalDistance() const {
+        if (!m_distanceCalculated) {
+            m_pathLength = 0.0;
+            if (m_graph && m_sequence.size() >= 2) {
+                const DistanceMatrix& matrix = m_graph->getDistanceMatrix();
+                for (size_t i = 0; i + 1 < m_sequence.size(); ++i) {
+                    m_pathLength += matrix.at(m_sequence[i], m_sequence[i + 1]);
+                }
+            }
+            m_distanceCalculated = true;
+        }
+        return m_graph ? m_pathLength + closingEdge() : 0.0;
+    }
+
+    /**
+     * @brief Materializa o ponto na posição indicada
+     */
+    Point getPoint(size_t position) const {
+        if (position >= m_sequence.size()) throw TSPException("Index out of bounds");
+        requireGraph();
+        return m_graph->getPoint(m_sequence[position]);
+    }
+
+    /**
+     * @brief Materializa todos os pontos da rota (cópia sob demanda)
+     */
+    std::vector<Point> getPoints() const {
+        std::vector<Point> points;
+        if (!m_graph) return points;
+        points.reserve(m_sequence.size());
+        for (uint32_t index : m_sequence) {
+            points.push_back(m_graph->getPoint(index));
+        }
+        return points;
+    }
+
+    bool operator<(const Route& other) const {
+        return getTotalDistance() < other.getTotalDistance();
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const Route& route) {
+        os << "Route[" << route.size() << " points, distance="
+           << route.getTotalDistance() << "]: ";
+        if (!route.m_graph) return os;
+        for (size_t i = 0; i < route.m_sequence.size(); ++i) {
+            if (i > 0) os << " -> ";
+            os << route.m_graph->getName(route.m_sequence[i]);
+        }
+        if (route.m_sequence.size() >= 3) {
+            os << " -> " << route.m_graph->getName(route.m_sequence[0]);
+        }
+        return os;
+    }
+};
+
+#endif // ROUTE_H
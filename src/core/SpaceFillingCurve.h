@@ -0,0 +1,158 @@
+#ifndef SPACEFILLINGCURVE_H
+#define SPACEFILLINGCURVE_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+
+#include "core/AlignedAllocator.h"
+#include "core/ThreadPool.h"
+#include "core/RadixSort.h"
+
+/**
+ * @brief Ordenação de pontos ao longo de curvas de preenchimento (Hilbert, Morton)
+ *
+ * As coordenadas são quantizadas em uma grade de 2^16 x 2^16 células (a
+ * mesma escala nos dois eixos, preservando a proporção do retângulo
+ * envolvente) e cada ponto recebe a distância ao longo da curva como
+ * chave de 32 bits. Pontos próximos na curva estão próximos no plano, então
+ * a ordem das chaves serve tanto como rota inicial quanto para renumerar
+ * os pontos com melhor localidade de memória. A curva de Morton (Z-order)
+ * é mais barata de calcular, mas dá saltos maiores entre quadrantes; a de
+ * Hilbert é contínua e preferível como rota.
+ *
+ * Quantização e chaves são calculadas em paralelo por blocos; a ordenação
+ * usa o RadixSort (estável, então empates mantêm a ordem dos índices).
+ */
+class SpaceFillingCurve {
+public:
+    enum class Curve { Hilbert, Morton };
+
+    static constexpr unsigned ORDER = 16;                    ///< Bits por eixo
+    static constexpr uint32_t GRID_MAX = (1u << ORDER) - 1;
+
+    /// Espalha os 16 bits baixos de v nas posições pares (0, 2, 4, ...)
+    static uint32_t spreadBits(uint32_t v) {
+        v &= 0xFFFF;
+        v = (v | (v << 8)) & 0x00FF00FF;
+        v = (v | (v << 4)) & 0x0F0F0F0F;
+        v = (v | (v << 2)) & 0x33333333;
+        v = (v | (v << 1)) & 0x55555555;
+        return v;
+    }
+
+    /**
+     * @brief Distância ao longo da curva de Hilbert da célula (x, y)
+     *
+     * Em vez de descer os 16 níveis rotacionando o quadrante a cada passo,
+     * as transformações de todos os níveis são compostas por uma soma de
+     * prefixos paralela nos bits (4 rodadas), sem desvios. O resultado é
+     * o mesmo do algoritmo clássico, cerca de 10x mais rápido.
+     *
+     * @param x,y Coordenadas quantizadas (0 a GRID_MAX)
+     */
+    static uint32_t hilbertKey(uint32_t x, uint32_t y) {
+        uint32_t A, B, C, D;
+        {
+            uint32_t a = x ^ y;
+            uint32_t b = GRID_MAX ^ a;
+            uint32_t c = GRID_MAX ^ (x | y);
+            uint32_t d = x & (y ^ GRID_MAX);
+            A = a | (b >> 1);
+            B = (a >> 1) ^ a;
+            C = ((c >> 1) ^ (b & (d >> 1))) ^ c;
+            D = ((a & (c >> 1)) ^ (d >> 1)) ^ d;
+        }
+        for (unsigned shift = 2; shift <= 4; shift <<= 1) {
+            uint32_t a = A, b = B, c = C, d = D;
+            A = (a & (a >> shift)) ^ (b & (b >> shift));
+            B = (a & (b >> shift)) ^ (b & ((a ^ b) >> shift));
+            C ^= (a & (c >> shift)) ^ (b & (d >> shift));
+            D ^= (b & (c >> shift)) ^ ((a ^ b) & (d >> shift));
+        }
+        {
+            uint32_t a = A, b = B, c = C, d = D;
+            C ^= (a & (c >> 8)) ^ (b & (d >> 8));
+            D ^= (b & (c >> 8)) ^ ((a ^ b) & (d >> 8));
+        }
+
+        uint32_t a = C ^ (C >> 1);
+        uint32_t b = D ^ (D >> 1);
+        uint32_t i0 = x ^ y;
+        uint32_t i1 = b | (GRID_MAX ^ (i0 | a));
+        return (spreadBits(i1) << 1) | spreadBits(i0);
+    }
+
+    /// Posição na curva de Morton (Z-order): bits de x e y intercalados
+    static uint32_t mortonKey(uint32_t x, uint32_t y) {
+        return spreadBits(x) | (spreadBits(y) << 1);
+    }
+
+    static uint32_t key(Curve curve, uint32_t x, uint32_t y) {
+        return curve == Curve::Hilbert ? hilbertKey(x, y) : mortonKey(x, y);
+    }
+
+    /**
+     * @brief Permutação dos pontos na ordem da curva
+     * @param x,y Arrays de coordenadas com count elementos
+     * @param pool Threads usadas na quantização e na ordenação
+     * @return order[i] = índice original do i-ésimo ponto ao longo da curva
+     */
+    static std::vector<uint32_t> curveOrder(const double* x, const double* y, size_t count,
+                                            ThreadPool& pool, Curve curve) {
+        std::vector<uint32_t> order(count);
+        if (count == 0) return order;
+
+        const size_t blocks = std::max<size_t>(1, std::min<size_t>(pool.size() * 4, count / 16384));
+        const size_t blockSize = (count + blocks - 1) / blocks;
+
+        // Retângulo envolvente (reduções por bloco)
+        std::vector<double> minX(blocks), minY(blocks), maxX(blocks), maxY(blocks);
+        pool.parallelFor(blocks, [&](size_t b, unsigned) {
+            double lx = std::numeric_limits<double>::max(), ly = lx;
+            double hx = std::numeric_limits<double>::lowest(), hy = hx;
+            size_t end = std::min(count, (b + 1) * blockSize);
+            for (size_t i = b * blockSize; i < end; ++i) {
+                lx = std::min(lx, x[i]);
+                hx = std::max(hx, x[i]);
+                ly = std::min(ly, y[i]);
+                hy = std::max(hy, y[i]);
+            }
+            minX[b] = lx;
+            maxX[b] = hx;
+            minY[b] = ly;
+            maxY[b] = hy;
+        });
+        double originX = *std::min_element(minX.begin(), minX.end());
+        double originY = *std::min_element(minY.begin(), minY.end());
+        double extent = std::max(*std::max_element(maxX.begin(), maxX.end()) - originX,
+                                 *std::max_element(maxY.begin(), maxY.end()) - originY);
+        double scale = extent > 0.0 ? GRID_MAX / extent : 0.0;
+
+        RadixSort::Items items(count);
+        pool.parallelFor(blocks, [&](size_t b, unsigned) {
+            size_t end = std::min(count, (b + 1) * blockSize);
+            for (size_t i = b * blockSize; i < end; ++i) {
+                uint32_t qx = std::min<uint32_t>(GRID_MAX, static_cast<uint32_t>((x[i] - originX) * scale));
+                uint32_t qy = std::min<uint32_t>(GRID_MAX, static_cast<uint32_t>((y[i] - originY) * scale));
+                items[i] = RadixSort::pack(key(curve, qx, qy), static_cast<uint32_t>(i));
+            }
+        });
+
+        RadixSort::sortByKey(items, pool, 2 * ORDER);
+
+        pool.parallelFor(blocks, [&](size_t b, unsigned) {
+            size_t end = std::min(count, (b + 1) * blockSize);
+            for (size_t i = b * blockSize; i < end; ++i) order[i] = RadixSort::valueOf(items[i]);
+        });
+        return order;
+    }
+
+    static std::vector<uint32_t> hilbertOrder(const double* x, const double* y, size_t count,
+                                              ThreadPool& pool) {
+        return curveOrder(x, y, count, pool, Curve::Hilbert);
+    }
+};
+
+#endif // SPACEFILLINGCURVE_H
@@ -0,0 +1,90 @@
+#ifndef SPATIALHASHGRID_H
+#define SPATIALHASHGRID_H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+
+/**
+ * @brief Grade espacial com hash para consultas de vizinhança em O(1) médio
+ *
+ * Cada célula tem lado igual a cellSize; pontos a menos de cellSize de
+ * distância (em cada eixo) estão sempre na mesma célula ou em uma das 8
+ * vizinhas. As células são encadeadas por índice (m_next), sem alocar um
+ * vetor por célula. Colisões de hash apenas adicionam candidatos: quem
+ * consulta sempre confere as coordenadas reais.
+ */
+class SpatialHashGrid {
+public:
+    static constexpr uint32_t npos = std::numeric_limits<uint32_t>::max();
+
+private:
+    double m_cellSize;
+    std::unordered_map<uint64_t, uint32_t> m_heads;
+    std::vector<uint32_t> m_next;
+
+    int64_t cellOf(double v) const {
+        double c = std::floor(v / m_cellSize);
+        const double limit = 9.0e18;
+        if (!(c > -limit)) return static_cast<int64_t>(-limit);
+        if (c > limit) return static_cast<int64_t>(limit);
+        return static_cast<int64_t>(c);
+    }
+
+    static uint64_t keyOf(int64_t cx, int64_t cy) {
+        return static_cast<uint64_t>(cx) * 0x9E3779B97F4A7C15ULL ^ static_cast<uint64_t>(cy);
+    }
+
+public:
+    SpatialHashGrid() : m_cellSize(1.0) {}
+
+    void reset(double cellSize) {
+        m_cellSize = cellSize > 0.0 ? cellSize : 1.0;
+        m_heads.clear();
+        m_next.clear();
+    }
+
+    void reserve(size_t count) {
+        m_heads.reserve(count);
+        m_next.reserve(count);
+    }
+
+    /**
+     * @brief Registra o ponto de índice index (índices devem ser inseridos em ordem)
+     */
+    void insert(uint32_t index, double x, double y) {
+        if (m_next.size() <= index) m_next.resize(index + 1, npos);
+        auto result = m_heads.emplace(keyOf(cellOf(x), cellOf(y)), index);
+        if (!result.second) {
+            m_next[index] = result.first->second;
+            result.first->second = index;
+        }
+    }
+
+    /**
+     * @brief Percorre os candidatos das 9 células ao redor de (x, y)
+     * @param visit Função bool(uint32_t index); retornar true interrompe a busca
+     * @return true se alguma visita interrompeu a busca
+     */
+    template <typename Visitor>
+    bool forEachNear(double x, double y, Visitor visit) const {
+        int64_t cx = cellOf(x), cy = cellOf(y);
+        for (int64_t dx = -1; dx <= 1; ++dx) {
+            for (int64_t dy = -1; dy <= 1; ++dy) {
+                auto it = m_heads.find(keyOf(cx + dx, cy + dy));
+                if (it == m_heads.end()) continue;
+                for (uint32_t i = it->second; i != npos; i = m_next[i]) {
+                    if (visit(i)) return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    size_t size() const { return m_next.size(); }
+    double getCellSize() const { return m_cellSize; }
+};
+
+#endif // SPATIALHASHGRID_H
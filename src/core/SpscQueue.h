@@ -0,0 +1,57 @@
+#ifndef SPSCQUEUE_H
+#define SPSCQUEUE_H
+
+#include <vector>
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Fila circular sem locks para um produtor e um consumidor
+ *
+ * Os elementos são pré-alocados e preenchidos/lidos no próprio slot (por
+ * uma função passada a tryPush/tryPop), então a troca de dados grandes,
+ * como indivíduos migrando entre ilhas, não copia nem aloca por item.
+ * Apenas uma thread pode produzir e apenas uma pode consumir.
+ */
+template <typename T>
+class SpscQueue {
+private:
+    std::vector<T> m_slots;
+    alignas(64) std::atomic<size_t> m_head{0};   ///< Próximo slot a ler
+    alignas(64) std::atomic<size_t> m_tail{0};   ///< Próximo slot a escrever
+
+public:
+    explicit SpscQueue(size_t capacity = 4) : m_slots(capacity + 1) {}
+
+    /// Acesso aos slots para pré-alocar o conteúdo antes do uso
+    std::vector<T>& slots() { return m_slots; }
+
+    /**
+     * @brief Preenche o próximo slot livre com fill(T&)
+     * @return false se a fila estiver cheia
+     */
+    template <typename Fill>
+    bool tryPush(Fill&& fill) {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t next = (tail + 1) % m_slots.size();
+        if (next == m_head.load(std::memory_order_acquire)) return false;
+        fill(m_slots[tail]);
+        m_tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Entrega o slot mais antigo a consume(T&) e o libera
+     * @return false se a fila estiver vazia
+     */
+    template <typename Consume>
+    bool tryPop(Consume&& consume) {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head == m_tail.load(std::memory_order_acquire)) return false;
+        consume(m_slots[head]);
+        m_head.store((head + 1) % m_slots.size(), std::memory_order_release);
+        return true;
+    }
+};
+
+#endif // SPSCQUEUE_H
@@ -0,0 +1,76 @@
+#ifndef STRINGTABLE_H
+#define STRINGTABLE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+/**
+ * @brief Tabela de strings internadas, endereçadas por índice
+ *
+ * Nomes repetidos são armazenados uma única vez; o Graph guarda apenas o
+ * índice (uint32_t) de cada nome, mantendo os dados de coordenadas livres
+ * de std::string.
+ *
+ * Cargas em lote (assignUnique) recebem as strings já sem repetição e
+ * adiam o índice de busca até o próximo intern.
+ */
+class StringTable {
+private:
+    std::vector<std::string> m_strings;
+    std::unordered_map<std::string, uint32_t> m_lookup;
+    bool m_lookupStale = false;     ///< m_lookup precisa ser refeito (após assignUnique)
+
+    void rebuildLookup() {
+        m_lookup.clear();
+        m_lookup.reserve(m_strings.size());
+        for (uint32_t id = 0; id < m_strings.size(); ++id) m_lookup.emplace(m_strings[id], id);
+        m_lookupStale = false;
+    }
+
+public:
+    StringTable() { intern(""); }
+
+    /**
+     * @brief Retorna o índice da string, inserindo-a se ainda não existir
+     */
+    uint32_t intern(const std::string& value) {
+        if (m_lookupStale) rebuildLookup();
+        auto it = m_lookup.find(value);
+        if (it != m_lookup.end()) return it->second;
+        uint32_t id = static_cast<uint32_t>(m_strings.size());
+        m_strings.push_back(value);
+        m_lookup.emplace(value, id);
+        return id;
+    }
+
+    const std::string& get(uint32_t id) const { return m_strings[id]; }
+    const std::string& operator[](uint32_t id) const { return m_strings[id]; }
+
+    size_t size() const { return m_strings.size(); }
+
+    /**
+     * @brief Substitui a tabela por strings distintas e não vazias
+     *
+     * A string de índice i passa a ter id i + 1 (o id 0 continua sendo a
+     * string vazia). Quem chama garante que não há repetições.
+     */
+    void assignUnique(std::vector<std::string> strings) {
+        m_strings.clear();
+        m_strings.reserve(strings.size() + 1);
+        m_strings.emplace_back();
+        for (auto& value : strings) m_strings.push_back(std::move(value));
+        m_lookup.clear();
+        m_lookupStale = true;
+    }
+
+    void clear() {
+        m_strings.clear();
+        m_lookup.clear();
+        m_lookupStale = false;
+        intern("");
+    }
+};
+
+#endif // STRINGTABLE_H
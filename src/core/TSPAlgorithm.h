@@ -0,0 +1,74 @@
+#ifndef TSPALGORITHM_H
+#define TSPALGORITHM_H
+
+#include <string>
+#include <chrono>
+#include <unordered_map>
+
+#include "core/Graph.h"
+#include "core/Route.h"
+
+/**
+ * @brief Classe base abstrata para algoritmos TSP
+ * 
+ * Demonstra conceitos POO:
+ * - Herança e polimorfismo
+ * - Métodos virtuais puros
+ * - Padrão Strategy
+ */
+class TSPAlgorithm {
+protected:
+    long m_lastExecutionTime;
+
+    using Clock = std::chrono::high_resolution_clock;
+
+    void recordExecutionTime(Clock::time_point start) {
+        m_lastExecutionTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            Clock::now() - start).count();
+    }
+
+public:
+    TSPAlgorithm() : m_lastExecutionTime(0) {}
+    virtual ~TSPAlgorithm() = default;
+    
+    virtual Route solve(const Graph& graph) = 0;
+    virtual std::string getName() const = 0;
+    virtual std::string getDescription() const = 0;
+
+    /**
+     * @brief Define parâmetros do algoritmo (opcional)
+     *
+     * Chaves desconhecidas são ignoradas, para que um mesmo mapa possa ser
+     * repassado a vários algoritmos.
+     */
+    virtual void setParameters(const std::unordered_map<std::string, double>& params) {
+        (void)params;
+    }
+    
+    long getLastExecutionTime() const { return m_lastExecutionTime; }
+};
+
+/**
+ * @brief Interface de algoritmos que melhoram uma rota já existente
+ *
+ * Implementada junto com TSPAlgorithm pelas buscas locais, permite
+ * encadear melhorias sobre a rota de qualquer construtivo (ChainTSP).
+ *
+ * Demonstra conceitos POO:
+ * - Herança múltipla de interfaces
+ */
+class TSPImprover {
+public:
+    virtual ~TSPImprover() = default;
+
+    /**
+     * @brief Melhora a rota (warm start)
+     * @param start Rota inicial, vinculada a um Graph
+     */
+    virtual Route improve(const Route& start) = 0;
+
+    /// Limite de tempo em ms (0 = sem limite)
+    virtual void setTimeLimit(long milliseconds) = 0;
+};
+
+#endif // TSPALGORITHM_H
@@ -0,0 +1,18 @@
+#ifndef TSPEXCEPTION_H
+#define TSPEXCEPTION_H
+
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Classe de exceção personalizada para operações TSP
+ */
+class TSPException : public std::exception {
+private:
+    std::string m_message;
+public:
+    explicit TSPException(const std::string& message) : m_message(message) {}
+    const char* what() const noexcept override { return m_message.c_str(); }
+};
+
+#endif // TSPEXCEPTION_H
@@ -0,0 +1,128 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+
+/**
+ * @brief Pool fixo de threads para laços paralelos repetidos
+ *
+ * As threads são criadas uma vez e reutilizadas a cada parallelFor, o que
+ * evita o custo de criar threads em laços curtos e repetidos (uma geração
+ * do algoritmo genético, uma iteração das formigas). A thread chamadora
+ * também trabalha, como participante 0. Os índices são distribuídos em
+ * blocos por um contador atômico, e o corpo do laço é chamado por ponteiro
+ * de função, sem alocar memória por chamada.
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_finished;
+    uint64_t m_round = 0;
+    size_t m_running = 0;
+    bool m_stop = false;
+
+    void (*m_invoke)(void*, size_t, unsigned) = nullptr;
+    void* m_body = nullptr;
+    size_t m_count = 0;
+    size_t m_grain = 1;
+    std::atomic<size_t> m_next{0};
+
+    void drain(unsigned participant) {
+        for (size_t begin = m_next.fetch_add(m_grain); begin < m_count;
+             begin = m_next.fetch_add(m_grain)) {
+            size_t end = std::min(m_count, begin + m_grain);
+            for (size_t i = begin; i < end; ++i) m_invoke(m_body, i, participant);
+        }
+    }
+
+    void workerLoop(unsigned participant) {
+        uint64_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&] { return m_stop || m_round != seen; });
+                if (m_stop) return;
+                seen = m_round;
+            }
+            drain(participant);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_running == 0) m_finished.notify_one();
+            }
+        }
+    }
+
+public:
+    /**
+     * @param threads Total de participantes, incluindo a thread chamadora
+     *                (0 = hardware_concurrency())
+     */
+    explicit ThreadPool(unsigned threads = 0) {
+        if (threads == 0) threads = std::thread::hardware_concurrency();
+        if (threads == 0) threads = 1;
+        for (unsigned t = 1; t < threads; ++t) {
+            m_workers.emplace_back(&ThreadPool::workerLoop, this, t);
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers) worker.join();
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Número de participantes (threads do pool + a chamadora)
+    unsigned size() const { return static_cast<unsigned>(m_workers.size() + 1); }
+
+    /**
+     * @brief Executa body(i, participante) para i em [0, count) e espera o fim
+     * @param body Função void(size_t index, unsigned participant); o índice
+     *             do participante (0..size()-1) serve para escolher buffers
+     *             de trabalho por thread
+     * @param grain Índices entregues por vez (0 = automático, count / (8 ×
+     *              participantes)); use 1 quando cada índice é uma tarefa longa
+     */
+    template <typename Body>
+    void parallelFor(size_t count, Body&& body, size_t grain = 0) {
+        if (count == 0) return;
+        if (m_workers.empty() || count == 1) {
+            for (size_t i = 0; i < count; ++i) body(i, 0u);
+            return;
+        }
+
+        m_invoke = [](void* b, size_t i, unsigned participant) {
+            (*static_cast<std::remove_reference_t<Body>*>(b))(i, participant);
+        };
+        m_body = static_cast<void*>(&body);
+        m_count = count;
+        m_grain = grain ? grain : std::max<size_t>(1, count / (size() * 8));
+        m_next.store(0);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_running = m_workers.size();
+            ++m_round;
+        }
+        m_wake.notify_all();
+
+        drain(0);
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_finished.wait(lock, [&] { return m_running == 0; });
+    }
+};
+
+#endif // THREADPOOL_H
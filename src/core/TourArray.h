@@ -0,0 +1,167 @@
+#ifndef TOURARRAY_H
+#define TOURARRAY_H
+
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * @brief Representação de trabalho de uma rota para busca local
+ *
+ * Guarda a ordem das cidades e a posição de cada cidade, permitindo
+ * sucessor/predecessor em O(1). A reversão de segmento (movimento 2-opt)
+ * sempre inverte o lado mais curto do ciclo, o que é equivalente para o
+ * TSP simétrico. O deslocamento de segmento (Or-opt) move os elementos do
+ * lado mais curto entre o segmento e o ponto de inserção.
+ */
+class TourArray {
+private:
+    std::vector<uint32_t> m_order;
+    std::vector<uint32_t> m_pos;
+
+public:
+    TourArray() = default;
+
+    explicit TourArray(const std::vector<uint32_t>& order) { assign(order); }
+
+    void assign(const std::vector<uint32_t>& order) { assign(order.data(), order.size()); }
+
+    /// Reaproveita a memória já alocada quando o tamanho não muda
+    void assign(const uint32_t* order, size_t count) {
+        m_order.assign(order, order + count);
+        m_pos.resize(count);
+        for (size_t i = 0; i < count; ++i) m_pos[order[i]] = static_cast<uint32_t>(i);
+    }
+
+    size_t size() const { return m_order.size(); }
+    uint32_t at(size_t position) const { return m_order[position]; }
+    uint32_t pos(uint32_t city) const { return m_pos[city]; }
+
+    uint32_t next(uint32_t city) const {
+        uint32_t p = m_pos[city] + 1;
+        return m_order[p == m_order.size() ? 0 : p];
+    }
+
+    uint32_t prev(uint32_t city) const {
+        uint32_t p = m_pos[city];
+        return m_order[p == 0 ? m_order.size() - 1 : p - 1];
+    }
+
+    /**
+     * @brief true se b está no caminho de a até c seguindo a orientação
+     */
+    bool between(uint32_t a, uint32_t b, uint32_t c) const {
+        uint32_t pa = m_pos[a], pb = m_pos[b], pc = m_pos[c];
+        if (pa <= pc) return pa <= pb && pb <= pc;
+        return pb >= pa || pb <= pc;
+    }
+
+    /**
+     * @brief Inverte o caminho da cidade from até a cidade to (inclusive)
+     *
+     * Se o segmento for maior que metade do ciclo, inverte o complemento.
+     */
+    void reverse(uint32_t from, uint32_t to) {
+        const size_t n = m_order.size();
+        size_t i = m_pos[from], j = m_pos[to];
+        size_t length = (j + n - i) % n + 1;
+        if (2 * length > n) {
+            // Complemento: de next(to) até prev(from)
+            i = (j + 1) % n;
+            j = (m_pos[from] + n - 1) % n;
+            length = n - length;
+        }
+        for (size_t s = 0; s < length / 2; ++s) {
+            uint32_t a = m_order[i], b = m_order[j];
+            m_order[i] = b; m_pos[b] = static_cast<uint32_t>(i);
+            m_order[j] = a; m_pos[a] = static_cast<uint32_t>(j);
+            i = (i + 1 == n) ? 0 : i + 1;
+            j = (j == 0) ? n - 1 : j - 1;
+        }
+    }
+
+    /**
+     * @brief Movimento 2-opt: troca as arestas a-b e c-d por a-c e b-d
+     *
+     * b deve seguir a e d deve seguir c no mesmo sentido de percurso, que
+     * pode ser o do array ou o inverso.
+     */
+    void twoOptMove(uint32_t a, uint32_t b, uint32_t c, uint32_t /*d*/) {
+        if (next(a) == b) reverse(b, c);
+        else reverse(c, b);
+    }
+
+    /**
+     * @brief Move o segmento s1..s2 (caminho no sentido do array) para entre
+     *        a cidade after e seu sucessor
+     * @param reversed false: after-s1...s2-next(after); true: after-s2...s1-next(after)
+     *
+     * after não pode pertencer ao segmento nem ser o predecessor de s1.
+     */
+    void moveSegment(uint32_t s1, uint32_t s2, uint32_t after, bool reversed) {
+        const size_t n = m_order.size();
+        const size_t first = m_pos[s1];
+        const size_t length = (m_pos[s2] + n - first) % n + 1;
+
+        uint32_t segment[8];
+        std::vector<uint32_t> large;
+        uint32_t* buffer = segment;
+        if (length > 8) {
+            large.resize(length);
+            buffer = large.data();
+        }
+        for (size_t k = 0; k < length; ++k) buffer[k] = m_order[(first + k) % n];
+        if (reversed) std::reverse(buffer, buffer + length);
+
+        auto place = [&](size_t slot, uint32_t city) {
+            m_order[slot] = city;
+            m_pos[city] = static_cast<uint32_t>(slot);
+        };
+
+        // Elementos entre o fim do segmento e after (sentido direto)
+        size_t forwardGap = (m_pos[after] + n - m_pos[s2]) % n;
+        if (forwardGap <= n - length - forwardGap) {
+            size_t slot = first;
+            size_t k = (m_pos[s2] + 1) % n;
+            for (size_t c = 0; c < forwardGap; ++c) {
+                place(slot, m_order[k]);
+                slot = (slot + 1) % n;
+                k = (k + 1) % n;
+            }
+            for (size_t c = 0; c < length; ++c) {
+                place(slot, buffer[c]);
+                slot = (slot + 1) % n;
+            }
+        } else {
+            // Desloca para frente os elementos de next(after) até prev(s1)
+            size_t backwardGap = n - length - forwardGap;
+            size_t slot = m_pos[s2];
+            size_t k = (first + n - 1) % n;
+            for (size_t c = 0; c < backwardGap; ++c) {
+                place(slot, m_order[k]);
+                slot = (slot + n - 1) % n;
+                k = (k + n - 1) % n;
+            }
+            for (size_t c = length; c > 0; --c) {
+                place(slot, buffer[c - 1]);
+                slot = (slot + n - 1) % n;
+            }
+        }
+    }
+
+    /**
+     * @brief Ordem começando pela cidade indicada (para voltar a ser uma Route)
+     */
+    std::vector<uint32_t> orderFrom(uint32_t first) const {
+        std::vector<uint32_t> order;
+        order.reserve(m_order.size());
+        size_t start = m_pos[first];
+        order.insert(order.end(), m_order.begin() + start, m_order.end());
+        order.insert(order.end(), m_order.begin(), m_order.begin() + start);
+        return order;
+    }
+
+    const std::vector<uint32_t>& order() const { return m_order; }
+};
+
+#endif // TOURARRAY_H
@@ -2,6 +2,7 @@
 #include "GraphView.h"
 #include "RouteVisualizer.h"
 
+#include <QFileInfo>
 #include <iostream>
 #include <random>
 
@@ -17,6 +18,9 @@ MainWindow::MainWindow(QWidget *parent)
     setupMenuBar();
     setupStatusBar();
     
+    // Cliques do mouse têm variação natural: pontos a menos de 5px são duplicados
+    m_graph->setDuplicateTolerance(5.0);
+    
     // Inicializar timer para atualizações
     m_timer = new QTimer(this);
     connect(m_timer, &QTimer::timeout, this, &MainWindow::updateMetrics);
@@ -24,6 +28,23 @@ MainWindow::MainWindow(QWidget *parent)
     // Configurar algoritmos disponíveis
     m_algorithmCombo->addItem("Nearest Neighbor");
     m_algorithmCombo->addItem("Brute Force");
+    m_algorithmCombo->addItem("Held-Karp (exato)");
+    m_algorithmCombo->addItem("Nearest Neighbor + 2-Opt");
+    m_algorithmCombo->addItem("Nearest Neighbor + Busca Local (2-Opt/Or-Opt)");
+    m_algorithmCombo->addItem("Nearest Neighbor + Lin-Kernighan");
+    m_algorithmCombo->addItem("Algoritmo Genético");
+    m_algorithmCombo->addItem("Algoritmo Genético (ilhas)");
+    m_algorithmCombo->addItem("Simulated Annealing (parallel tempering)");
+    m_algorithmCombo->addItem("Colônia de Formigas (MMAS)");
+    m_algorithmCombo->addItem("Curva de Hilbert");
+    m_algorithmCombo->addItem("Arestas Gulosas (Greedy Edge)");
+    m_algorithmCombo->addItem("Inserção Mais Barata");
+    m_algorithmCombo->addItem("Inserção do Mais Próximo");
+    m_algorithmCombo->addItem("Inserção do Mais Distante");
+    m_algorithmCombo->addItem("Fecho Convexo + Inserção");
+    m_algorithmCombo->addItem("Economias de Clarke-Wright");
+    m_algorithmCombo->addItem("Árvore Dupla (MST)");
+    m_algorithmCombo->addItem("Christofides (emparelhamento guloso)");
     
     // Conectar sinais
     connect(m_algorithmCombo, QOverload<int>::of(&QComboBox::currentIndexChanged),
@@ -213,8 +234,40 @@ void MainWindow::newGraph()
 
 void MainWindow::openGraph()
 {
-    // Implementação básica - pode ser expandida para carregar de arquivo
-    QMessageBox::information(this, "Abrir", "Funcionalidade de abrir arquivo será implementada em versão futura");
+    QString path = QFileDialog::getOpenFileName(this, "Abrir instância", QString(),
+                                                "Instâncias (*.tsp *.tspb *.csv *.jsonl *.ndjson);;TSPLIB (*.tsp);;"
+                                                "Binário (*.tspb);;CSV (*.csv);;JSON lines (*.jsonl *.ndjson);;"
+                                                "Todos os arquivos (*)");
+    if (path.isEmpty()) return;
+    
+    try {
+        // Carrega em um grafo novo: se o arquivo for inválido o atual fica intacto
+        auto graph = std::make_unique<Graph>();
+        graph->setDuplicateTolerance(m_graph->getDuplicateTolerance());
+        auto start = std::chrono::high_resolution_clock::now();
+        std::string name = InstanceReader::load(path.toStdString(), *graph);
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start);
+        
+        // A rota referencia o grafo antigo: desvincular antes de trocar
+        m_graphView->setRoute(nullptr);
+        m_bestRoute.reset();
+        m_graph = std::move(graph);
+        
+        auto graphPtr = std::shared_ptr<Graph>(m_graph.get(), [](Graph*){});
+        m_graphView->setGraph(graphPtr);
+        
+        resetMetrics();
+        updateMetrics();
+        m_resultsText->clear();
+        statusBar()->showMessage(QString("Carregado %1: %2 cidades em %3 ms")
+            .arg(QString::fromStdString(name))
+            .arg(m_graph->getSize())
+            .arg(duration.count()));
+        
+    } catch (const TSPException& e) {
+        QMessageBox::warning(this, "Erro", QString("Erro ao abrir arquivo: %1").arg(e.what()));
+    }
 }
 
 void MainWindow::saveGraph()
@@ -229,7 +282,33 @@ void MainWindow::exportRoute()
         QMessageBox::warning(this, "Exportar", "Nenhuma rota para exportar");
         return;
     }
-    QMessageBox::information(this, "Exportar", "Funcionalidade de exportar será implementada em versão futura");
+    
+    QString selectedFilter;
+    QString path = QFileDialog::getSaveFileName(this, "Exportar rota", QString(),
+                                                "TSPLIB (*.tour);;CSV (*.csv);;Binário (*.tourb)",
+                                                &selectedFilter);
+    if (path.isEmpty()) return;
+    
+    // Sem extensão: usa a do filtro escolhido
+    if (QFileInfo(path).suffix().isEmpty()) {
+        if (selectedFilter.startsWith("CSV")) path += ".csv";
+        else if (selectedFilter.startsWith("Bin")) path += ".tourb";
+        else path += ".tour";
+    }
+    
+    try {
+        auto start = std::chrono::high_resolution_clock::now();
+        uint64_t bytes = TourFile::write(path.toStdString(), *m_bestRoute,
+                                         QFileInfo(path).completeBaseName().toStdString());
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - start);
+        statusBar()->showMessage(QString("Rota exportada para %1: %2 KB em %3 ms")
+            .arg(path)
+            .arg(static_cast<qulonglong>(bytes / 1024))
+            .arg(duration.count()));
+    } catch (const TSPException& e) {
+        QMessageBox::warning(this, "Erro", QString("Erro ao exportar rota: %1").arg(e.what()));
+    }
 }
 
 void MainWindow::showAbout()
@@ -274,8 +353,15 @@ void MainWindow::addRandomPoints()
 
 void MainWindow::clearGraph()
 {
-    m_graph->clear();
+    // A rota referencia o grafo: desvincular da visualização antes de limpar
+    m_graphView->setRoute(nullptr);
     m_bestRoute.reset();
+    m_graph->clear();
+    
+    // Um grafo novo volta à distância euclidiana (a carga TSPLIB troca a métrica)
+    DistanceMatrix::Config config = m_graph->getDistanceConfig();
+    config.metric = DistanceMetric::Euclidean;
+    m_graph->setDistanceConfig(config);
     
     // Atualizar GraphView com o graph limpo
     auto graphPtr = std::shared_ptr<Graph>(m_graph.get(), [](Graph*){});
@@ -363,6 +449,28 @@ std::unique_ptr<TSPAlgorithm> MainWindow::createSelectedAlgorithm()
     switch (index) {
         case 0: return std::make_unique<NearestNeighborTSP>();
         case 1: return std::make_unique<BruteForceTSP>();
+        case 2: return std::make_unique<HeldKarpTSP>();
+        case 3: return std::make_unique<TwoOptTSP>();
+        case 4: return std::make_unique<LocalSearchTSP>();
+        case 5: return std::make_unique<LinKernighanTSP>();
+        case 6: return std::make_unique<GeneticTSP>();
+        case 7: {
+            auto genetic = std::make_unique<GeneticTSP>();
+            unsigned cores = std::max(2u, std::thread::hardware_concurrency());
+            genetic->setParameters({{"islands", static_cast<double>(cores)}});
+            return genetic;
+        }
+        case 8: return std::make_unique<SimulatedAnnealingTSP>();
+        case 9: return std::make_unique<AntColonyTSP>();
+        case 10: return std::make_unique<HilbertCurveTSP>();
+        case 11: return std::make_unique<GreedyEdgeTSP>();
+        case 12: return std::make_unique<CheapestInsertionTSP>();
+        case 13: return std::make_unique<NearestInsertionTSP>();
+        case 14: return std::make_unique<FarthestInsertionTSP>();
+        case 15: return std::make_unique<ConvexHullInsertionTSP>();
+        case 16: return std::make_unique<ClarkeWrightTSP>();
+        case 17: return std::make_unique<DoubleTreeTSP>();
+        case 18: return std::make_unique<ChristofidesTSP>();
         default: return std::make_unique<NearestNeighborTSP>();
     }
 }
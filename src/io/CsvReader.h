@@ -0,0 +1,70 @@
+#ifndef CSVREADER_H
+#define CSVREADER_H
+
+#include <string>
+#include <cstring>
+#include <charconv>
+
+#include "core/Graph.h"
+#include "io/PointIngest.h"
+
+/**
+ * @brief Leitor de pontos em CSV: linhas "nome,x,y" ou "x,y"
+ *
+ * A primeira linha é ignorada se não for numérica (cabeçalho). Linhas
+ * vazias são puladas; aspas não são tratadas (nomes sem vírgula). A carga
+ * é paralela por blocos (PointIngest) e substitui os pontos do grafo, sem
+ * a verificação de duplicatas.
+ */
+class CsvReader {
+private:
+    static bool parseNumber(const char* begin, const char* end, double& value) {
+        while (begin < end && (*begin == ' ' || *begin == '\t')) ++begin;
+        while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) --end;
+        if (begin < end && *begin == '+') ++begin;
+        auto parsed = std::from_chars(begin, end, value);
+        return begin < end && parsed.ec == std::errc() && parsed.ptr == end;
+    }
+
+public:
+    /// Formato de linha para PointIngest
+    struct Format {
+        static constexpr const char* NAME = "CSV";
+        static constexpr bool HEADER_LINE = true;
+
+        static LineStatus parse(const char* begin, const char* end, PointFields& fields, std::string&) {
+            if (end > begin && end[-1] == '\r') --end;
+            if (begin == end) return LineStatus::Skip;
+
+            const char* first = static_cast<const char*>(std::memchr(begin, ',', static_cast<size_t>(end - begin)));
+            if (!first) return LineStatus::Invalid;
+            const char* second = static_cast<const char*>(std::memchr(first + 1, ',', static_cast<size_t>(end - first - 1)));
+            if (!second) {
+                fields.name = std::string_view();
+                return parseNumber(begin, first, fields.x) && parseNumber(first + 1, end, fields.y)
+                    ? LineStatus::Point : LineStatus::Invalid;
+            }
+            if (std::memchr(second + 1, ',', static_cast<size_t>(end - second - 1))) return LineStatus::Invalid;
+            fields.name = std::string_view(begin, static_cast<size_t>(first - begin));
+            return parseNumber(first + 1, second, fields.x) && parseNumber(second + 1, end, fields.y)
+                ? LineStatus::Point : LineStatus::Invalid;
+        }
+    };
+
+    /**
+     * @brief Carrega o arquivo para o grafo, substituindo seus pontos
+     * @param threads Threads (0 = hardware_concurrency())
+     * @return Quantidade de pontos e tempo de cada etapa
+     * @throws TSPException se o arquivo não existir ou tiver linha inválida
+     */
+    static IngestStats load(const std::string& path, Graph& graph, unsigned threads = 0) {
+        return PointIngest::load<Format>(path, graph, threads);
+    }
+
+    /// Carrega a partir de um texto já em memória
+    static IngestStats parse(const char* begin, const char* end, Graph& graph, unsigned threads = 0) {
+        return PointIngest::parse<Format>(begin, end, graph, threads);
+    }
+};
+
+#endif // CSVREADER_H
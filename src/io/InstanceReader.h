@@ -0,0 +1,86 @@
+#ifndef INSTANCEREADER_H
+#define INSTANCEREADER_H
+
+#include <string>
+#include <cctype>
+
+#include "core/Graph.h"
+#include "core/TSPException.h"
+#include "io/TsplibReader.h"
+#include "io/TspbFile.h"
+#include "io/CsvReader.h"
+#include "io/JsonLinesReader.h"
+
+/**
+ * @brief Carrega uma instância escolhendo o leitor pela extensão
+ *
+ * .tsp → TsplibReader, .tspb → TspbFile (mapeado, sem cópia),
+ * .csv → CsvReader, .jsonl/.ndjson → JsonLinesReader.
+ */
+class InstanceReader {
+public:
+    enum class Format { Tsplib, Tspb, Csv, JsonLines };
+
+private:
+    static std::string extensionOf(const std::string& path) {
+        std::string extension;
+        size_t dot = path.find_last_of('.');
+        if (dot != std::string::npos && path.find_first_of("/\\", dot) == std::string::npos) {
+            for (char c : path.substr(dot + 1)) {
+                extension += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+        }
+        return extension;
+    }
+
+public:
+    /// Verdadeiro se a extensão é de um formato de instância conhecido
+    static bool recognizes(const std::string& path) {
+        std::string extension = extensionOf(path);
+        return extension == "tsp" || extension == "tspb" || extension == "csv"
+            || extension == "jsonl" || extension == "ndjson";
+    }
+
+    static Format formatOf(const std::string& path) {
+        std::string extension = extensionOf(path);
+        if (extension == "tsp") return Format::Tsplib;
+        if (extension == "tspb") return Format::Tspb;
+        if (extension == "csv") return Format::Csv;
+        if (extension == "jsonl" || extension == "ndjson") return Format::JsonLines;
+        throw TSPException("Unknown instance format: " + path);
+    }
+
+    /**
+     * @brief Carrega o arquivo, substituindo os pontos do grafo
+     * @param stats Tempo por etapa das cargas paralelas (CSV, JSON lines), se não nulo
+     * @param threads Threads das cargas paralelas (0 = hardware_concurrency())
+     * @return Nome da instância (NAME da TSPLIB ou o nome do arquivo)
+     */
+    static std::string load(const std::string& path, Graph& graph, IngestStats* stats = nullptr,
+                            unsigned threads = 0) {
+        std::string name = path.substr(path.find_last_of("/\\") + 1);
+        switch (formatOf(path)) {
+            case Format::Tsplib: {
+                TsplibInfo info = TsplibReader::load(path, graph);
+                if (!info.name.empty()) name = info.name;
+                break;
+            }
+            case Format::Tspb:
+                TspbFile::open(path, graph);
+                break;
+            case Format::Csv: {
+                IngestStats result = CsvReader::load(path, graph, threads);
+                if (stats) *stats = result;
+                break;
+            }
+            case Format::JsonLines: {
+                IngestStats result = JsonLinesReader::load(path, graph, threads);
+                if (stats) *stats = result;
+                break;
+            }
+        }
+        return name;
+    }
+};
+
+#endif // INSTANCEREADER_H
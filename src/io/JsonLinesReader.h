@@ -0,0 +1,218 @@
+#ifndef JSONLINESREADER_H
+#define JSONLINESREADER_H
+
+#include <string>
+#include <cstdint>
+#include <charconv>
+
+#include "core/Graph.h"
+#include "io/PointIngest.h"
+
+/**
+ * @brief Leitor de pontos em JSON lines: um objeto por linha
+ *
+ * Cada linha é um objeto com "x" e "y" numéricos e, opcionalmente, "name"
+ * (string ou número); outras chaves são ignoradas, inclusive objetos e
+ * arrays aninhados. Exemplo: {"name": "Loja 12", "x": 10.5, "y": -3}.
+ * Linhas vazias são puladas. Nomes com sequências de escape são
+ * decodificados para UTF-8. A carga é paralela por blocos (PointIngest).
+ */
+class JsonLinesReader {
+private:
+    static void skipSpaces(const char*& p, const char* end) {
+        while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) ++p;
+    }
+
+    static void appendUtf8(std::string& out, uint32_t code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    static bool hex4(const char*& p, const char* end, uint32_t& code) {
+        if (end - p < 4) return false;
+        auto parsed = std::from_chars(p, p + 4, code, 16);
+        if (parsed.ec != std::errc() || parsed.ptr != p + 4) return false;
+        p += 4;
+        return true;
+    }
+
+    /**
+     * @brief Lê uma string JSON (p no '"' inicial)
+     *
+     * Sem escapes, value aponta para o próprio texto; com escapes, o texto
+     * decodificado vai para scratch.
+     */
+    static bool readString(const char*& p, const char* end, std::string_view& value, std::string& scratch) {
+        const char* start = ++p;
+        while (p < end && *p != '"' && *p != '\\') ++p;
+        if (p < end && *p == '"') {
+            value = std::string_view(start, static_cast<size_t>(p - start));
+            ++p;
+            return true;
+        }
+        scratch.assign(start, p);
+        while (p < end && *p != '"') {
+            if (*p != '\\') {
+                scratch += *p++;
+                continue;
+            }
+            if (++p == end) return false;
+            char escape = *p++;
+            switch (escape) {
+                case '"': case '\\': case '/': scratch += escape; break;
+                case 'b': scratch += '\b'; break;
+                case 'f': scratch += '\f'; break;
+                case 'n': scratch += '\n'; break;
+                case 'r': scratch += '\r'; break;
+                case 't': scratch += '\t'; break;
+                case 'u': {
+                    uint32_t code;
+                    if (!hex4(p, end, code)) return false;
+                    uint32_t low;
+                    if (code >= 0xD800 && code < 0xDC00 && end - p >= 6 && p[0] == '\\' && p[1] == 'u') {
+                        const char* q = p + 2;
+                        if (hex4(q, end, low) && low >= 0xDC00 && low < 0xE000) {
+                            code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                            p = q;
+                        }
+                    }
+                    appendUtf8(scratch, code);
+                    break;
+                }
+                default: return false;
+            }
+        }
+        if (p == end) return false;
+        ++p;
+        value = std::string_view(scratch);
+        return true;
+    }
+
+    /// Fim de um número ou literal (true, false, null)
+    static const char* tokenEnd(const char* p, const char* end) {
+        while (p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\t' && *p != '\r') ++p;
+        return p;
+    }
+
+    /// Pula um valor qualquer, inclusive objetos e arrays aninhados
+    static bool skipValue(const char*& p, const char* end) {
+        if (p < end && (*p == '{' || *p == '[')) {
+            int depth = 0;
+            while (p < end) {
+                char c = *p;
+                if (c == '"') {
+                    for (++p; p < end && *p != '"'; ++p) {
+                        if (*p == '\\') ++p;
+                    }
+                    if (p >= end) return false;
+                } else if (c == '{' || c == '[') {
+                    ++depth;
+                } else if (c == '}' || c == ']') {
+                    if (--depth == 0) {
+                        ++p;
+                        return true;
+                    }
+                }
+                ++p;
+            }
+            return false;
+        }
+        if (p < end && *p == '"') {
+            std::string_view ignored;
+            std::string scratch;
+            return readString(p, end, ignored, scratch);
+        }
+        const char* stop = tokenEnd(p, end);
+        if (stop == p) return false;
+        p = stop;
+        return true;
+    }
+
+public:
+    /// Formato de linha para PointIngest
+    struct Format {
+        static constexpr const char* NAME = "JSON lines";
+        static constexpr bool HEADER_LINE = false;
+
+        static LineStatus parse(const char* p, const char* end, PointFields& fields, std::string& scratch) {
+            skipSpaces(p, end);
+            if (p == end) return LineStatus::Skip;
+            if (*p++ != '{') return LineStatus::Invalid;
+
+            bool hasX = false, hasY = false;
+            fields.name = std::string_view();
+            skipSpaces(p, end);
+            if (p < end && *p == '}') return LineStatus::Invalid;
+            while (p < end) {
+                if (*p != '"') return LineStatus::Invalid;
+                std::string_view key;
+                std::string keyScratch;
+                if (!readString(p, end, key, keyScratch)) return LineStatus::Invalid;
+                skipSpaces(p, end);
+                if (p == end || *p++ != ':') return LineStatus::Invalid;
+                skipSpaces(p, end);
+                if (p == end) return LineStatus::Invalid;
+
+                if (key == "x" || key == "y") {
+                    const char* stop = tokenEnd(p, end);
+                    double& target = key == "x" ? fields.x : fields.y;
+                    auto parsed = std::from_chars(p, stop, target);
+                    if (parsed.ec != std::errc() || parsed.ptr != stop) return LineStatus::Invalid;
+                    (key == "x" ? hasX : hasY) = true;
+                    p = stop;
+                } else if (key == "name") {
+                    if (*p == '"') {
+                        if (!readString(p, end, fields.name, scratch)) return LineStatus::Invalid;
+                    } else {
+                        const char* stop = tokenEnd(p, end);
+                        fields.name = std::string_view(p, static_cast<size_t>(stop - p));
+                        p = stop;
+                    }
+                } else if (!skipValue(p, end)) {
+                    return LineStatus::Invalid;
+                }
+
+                skipSpaces(p, end);
+                if (p == end) return LineStatus::Invalid;
+                if (*p == '}') {
+                    ++p;
+                    skipSpaces(p, end);
+                    return p == end && hasX && hasY ? LineStatus::Point : LineStatus::Invalid;
+                }
+                if (*p++ != ',') return LineStatus::Invalid;
+                skipSpaces(p, end);
+            }
+            return LineStatus::Invalid;
+        }
+    };
+
+    /**
+     * @brief Carrega o arquivo para o grafo, substituindo seus pontos
+     * @param threads Threads (0 = hardware_concurrency())
+     * @return Quantidade de pontos e tempo de cada etapa
+     * @throws TSPException se o arquivo não existir ou tiver linha inválida
+     */
+    static IngestStats load(const std::string& path, Graph& graph, unsigned threads = 0) {
+        return PointIngest::load<Format>(path, graph, threads);
+    }
+
+    /// Carrega a partir de um texto já em memória
+    static IngestStats parse(const char* begin, const char* end, Graph& graph, unsigned threads = 0) {
+        return PointIngest::parse<Format>(begin, end, graph, threads);
+    }
+};
+
+#endif // JSONLINESREADER_H
@@ -0,0 +1,121 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "core/TSPException.h"
+
+/**
+ * @brief Arquivo inteiro mapeado em memória, somente leitura
+ *
+ * Em POSIX usa mmap (MAP_SHARED, somente leitura), então o conteúdo é
+ * lido direto do cache de páginas sem cópia e processos que abrem o mesmo
+ * arquivo compartilham as mesmas páginas físicas; em outras plataformas o
+ * arquivo é lido para um buffer. O conteúdo é [data(), data() + size()),
+ * sem terminador.
+ *
+ * Demonstra conceitos POO:
+ * - RAII: o mapeamento é desfeito no destrutor
+ * - Semântica de movimento (não copiável)
+ */
+class MappedFile {
+private:
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    std::vector<char> m_buffer;     ///< Usado quando o mmap não está disponível
+
+    void release() {
+#ifndef _WIN32
+        if (m_mapped) munmap(const_cast<char*>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_mapped = false;
+        m_buffer.clear();
+    }
+
+    void readIntoBuffer(const std::string& path) {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) throw TSPException("Cannot open file: " + path);
+        m_buffer.resize(static_cast<size_t>(in.tellg()));
+        in.seekg(0);
+        if (!m_buffer.empty() && !in.read(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()))) {
+            throw TSPException("Cannot read file: " + path);
+        }
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+    }
+
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path, bool sequential = true) { open(path, sequential); }
+    ~MappedFile() { release(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept { *this = std::move(other); }
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            release();
+            m_buffer.swap(other.m_buffer);
+            m_data = m_buffer.empty() ? other.m_data : m_buffer.data();
+            m_size = other.m_size;
+            m_mapped = other.m_mapped;
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_mapped = false;
+        }
+        return *this;
+    }
+
+    /**
+     * @param sequential true para leitura em uma passada (parsers de texto);
+     *        false para acesso aleatório que deve permanecer em memória
+     */
+    void open(const std::string& path, bool sequential = true) {
+        release();
+#ifndef _WIN32
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw TSPException("Cannot open file: " + path);
+        struct stat info;
+        if (fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw TSPException("Cannot read file: " + path);
+        }
+        m_size = static_cast<size_t>(info.st_size);
+        if (m_size > 0) {
+            void* address = mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (address != MAP_FAILED) {
+                madvise(address, m_size, sequential ? MADV_SEQUENTIAL : MADV_WILLNEED);
+                m_data = static_cast<const char*>(address);
+                m_mapped = true;
+            }
+        }
+        ::close(fd);
+        if (m_size > 0 && !m_mapped) readIntoBuffer(path);     // ex.: pipes, /proc
+#else
+        (void)sequential;
+        readIntoBuffer(path);
+#endif
+    }
+
+    const char* data() const { return m_data; }
+    const char* begin() const { return m_data; }
+    const char* end() const { return m_data + m_size; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+};
+
+#endif // MAPPEDFILE_H
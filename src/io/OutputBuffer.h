@@ -0,0 +1,165 @@
+#ifndef OUTPUTBUFFER_H
+#define OUTPUTBUFFER_H
+
+#include <string>
+#include <string_view>
+#include <memory>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <algorithm>
+
+#include "core/TSPException.h"
+
+/**
+ * @brief Saída para arquivo com buffer próprio e formatação sem alocação
+ *
+ * Números são formatados com std::to_chars direto no buffer, que é
+ * descarregado em blocos grandes com fwrite (o buffer do stdio é
+ * desligado para não copiar duas vezes). Nenhuma escrita aloca memória,
+ * então o custo por registro fica em poucas dezenas de nanossegundos e
+ * arquivos grandes saem na velocidade do disco.
+ *
+ * Erros de escrita viram TSPException em flush()/close(); o destrutor
+ * fecha o arquivo sem lançar (chame close() para saber se deu certo).
+ *
+ * Demonstra conceitos POO:
+ * - RAII: o arquivo é fechado no destrutor
+ * - Encapsulamento do buffer e da formatação
+ */
+class OutputBuffer {
+private:
+    static constexpr size_t MAX_NUMBER_CHARS = 64;
+
+    std::FILE* m_file = nullptr;
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_capacity;
+    size_t m_size = 0;
+    uint64_t m_written = 0;
+    std::string m_path;
+
+    /// Garante espaço contíguo para count bytes no fim do buffer
+    char* room(size_t count) {
+        if (m_capacity - m_size < count) flush();
+        return m_buffer.get() + m_size;
+    }
+
+    void writeFile(const char* data, size_t size) {
+        if (size > 0 && std::fwrite(data, 1, size, m_file) != size) {
+            throw TSPException("Cannot write file: " + m_path);
+        }
+        m_written += size;
+    }
+
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1 << 20;
+
+    explicit OutputBuffer(const std::string& path, size_t capacity = DEFAULT_CAPACITY)
+        : m_buffer(new char[std::max(capacity, MAX_NUMBER_CHARS)]),
+          m_capacity(std::max(capacity, MAX_NUMBER_CHARS)), m_path(path) {
+        m_file = std::fopen(path.c_str(), "wb");
+        if (!m_file) throw TSPException("Cannot create file: " + path);
+        std::setvbuf(m_file, nullptr, _IONBF, 0);
+    }
+
+    ~OutputBuffer() {
+        if (!m_file) return;
+        if (m_size > 0) std::fwrite(m_buffer.get(), 1, m_size, m_file);
+        std::fclose(m_file);
+    }
+
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+
+    void write(const void* data, size_t size) {
+        const char* bytes = static_cast<const char*>(data);
+        if (size > m_capacity - m_size) {
+            flush();
+            if (size >= m_capacity) {
+                writeFile(bytes, size);
+                return;
+            }
+        }
+        std::memcpy(m_buffer.get() + m_size, bytes, size);
+        m_size += size;
+    }
+
+    void put(char c) {
+        *room(1) = c;
+        ++m_size;
+    }
+
+    void put(std::string_view text) { write(text.data(), text.size()); }
+
+    void putUnsigned(uint64_t value) {
+        char* out = room(MAX_NUMBER_CHARS);
+        m_size += static_cast<size_t>(std::to_chars(out, out + MAX_NUMBER_CHARS, value).ptr - out);
+    }
+
+    void putSigned(int64_t value) {
+        char* out = room(MAX_NUMBER_CHARS);
+        m_size += static_cast<size_t>(std::to_chars(out, out + MAX_NUMBER_CHARS, value).ptr - out);
+    }
+
+    /**
+     * @brief Escreve um double
+     * @param precision Casas decimais fixas; negativo = menor forma exata
+     */
+    void putDouble(double value, int precision = -1) {
+        char* out = room(MAX_NUMBER_CHARS);
+        auto result = precision < 0
+            ? std::to_chars(out, out + MAX_NUMBER_CHARS, value)
+            : std::to_chars(out, out + MAX_NUMBER_CHARS, value, std::chars_format::fixed, precision);
+        if (result.ec != std::errc()) {
+            // Valores enormes em notação fixa não cabem: cai para a forma curta
+            result = std::to_chars(out, out + MAX_NUMBER_CHARS, value);
+        }
+        m_size += static_cast<size_t>(result.ptr - out);
+    }
+
+    /// Campo CSV, entre aspas (RFC 4180) apenas se tiver vírgula, aspas ou quebra de linha
+    void putCsvField(std::string_view text) {
+        if (text.find_first_of(",\"\r\n") == std::string_view::npos) {
+            put(text);
+            return;
+        }
+        put('"');
+        for (size_t quote; (quote = text.find('"')) != std::string_view::npos; text.remove_prefix(quote + 1)) {
+            put(text.substr(0, quote + 1));
+            put('"');
+        }
+        put(text);
+        put('"');
+    }
+
+    /// Cópia binária de um valor trivial (na ordem de bytes da máquina)
+    template <typename T>
+    void putRaw(const T& value) {
+        std::memcpy(room(sizeof(T)), &value, sizeof(T));
+        m_size += sizeof(T);
+    }
+
+    void flush() {
+        size_t size = m_size;
+        m_size = 0;
+        writeFile(m_buffer.get(), size);
+    }
+
+    /**
+     * @brief Descarrega e fecha o arquivo
+     * @throws TSPException se alguma escrita falhou
+     */
+    void close() {
+        if (!m_file) return;
+        flush();
+        std::FILE* file = m_file;
+        m_file = nullptr;
+        if (std::fclose(file) != 0) throw TSPException("Cannot write file: " + m_path);
+    }
+
+    /// Bytes já entregues ao arquivo mais os pendentes no buffer
+    uint64_t bytesWritten() const { return m_written + m_size; }
+};
+
+#endif // OUTPUTBUFFER_H
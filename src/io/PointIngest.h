@@ -0,0 +1,267 @@
+#ifndef POINTINGEST_H
+#define POINTINGEST_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+
+#include "core/Graph.h"
+#include "core/ThreadPool.h"
+#include "core/TSPException.h"
+#include "io/MappedFile.h"
+
+/**
+ * @brief Tempo de cada etapa de uma carga de pontos (ms)
+ */
+struct IngestStats {
+    size_t bytes = 0;
+    size_t records = 0;
+    unsigned threads = 0;
+    double mapMs = 0.0;       ///< Abrir e mapear o arquivo
+    double splitMs = 0.0;     ///< Dividir em blocos e contar linhas
+    double parseMs = 0.0;     ///< Converter os campos (from_chars)
+    double internMs = 0.0;    ///< Montar a tabela de nomes
+    double assignMs = 0.0;    ///< Entregar os arrays ao Graph
+
+    double totalMs() const { return mapMs + splitMs + parseMs + internMs + assignMs; }
+    double megabytesPerSecond() const {
+        return totalMs() > 0.0 ? static_cast<double>(bytes) / 1e6 / (totalMs() / 1e3) : 0.0;
+    }
+};
+
+/**
+ * @brief Campos de um ponto extraídos de uma linha
+ *
+ * O nome aponta para o próprio texto da linha ou, se precisou ser
+ * decodificado (escapes JSON), para a string de rascunho do parser.
+ */
+struct PointFields {
+    double x = 0.0;
+    double y = 0.0;
+    std::string_view name;
+};
+
+/// Resultado do parser de uma linha
+enum class LineStatus { Point, Skip, Invalid };
+
+/**
+ * @brief Carga paralela de pontos de arquivos texto, um ponto por linha
+ *
+ * Etapas (ver IngestStats):
+ * 1. o arquivo mapeado é dividido em blocos que terminam em '\n';
+ * 2. as quebras de linha de cada bloco são contadas em paralelo, o que
+ *    dá o deslocamento de cada bloco nos arrays finais, alocados uma vez;
+ * 3. cada bloco é convertido em paralelo direto para x[], y[] do Graph;
+ * 4. os nomes são internados em paralelo: cada nome vai para uma fatia
+ *    (pelo hash), cada fatia elimina repetições sozinha e as fatias recebem
+ *    faixas consecutivas de ids (StringTable::assignUnique);
+ * 5. os arrays são movidos para o Graph (Graph::assignPoints).
+ *
+ * O formato é dado por Format, com:
+ * - static constexpr const char* NAME (para mensagens de erro);
+ * - static constexpr bool HEADER_LINE (primeira linha inválida é cabeçalho);
+ * - static LineStatus parse(const char* begin, const char* end,
+ *                           PointFields& fields, std::string& scratch).
+ */
+class PointIngest {
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr size_t MIN_CHUNK_BYTES = 1 << 20;
+    static constexpr size_t NAME_SHARDS = 64;
+
+    static double elapsedMs(Clock::time_point& start) {
+        auto now = Clock::now();
+        double ms = std::chrono::duration<double, std::milli>(now - start).count();
+        start = now;
+        return ms;
+    }
+
+    struct Chunk {
+        const char* begin;
+        const char* end;
+        size_t offset = 0;       ///< Primeiro índice do bloco nos arrays
+        size_t capacity = 0;     ///< Linhas no bloco (limite superior de pontos)
+        size_t count = 0;        ///< Pontos convertidos
+        const char* error = nullptr;
+        std::deque<std::string> decoded;   ///< Nomes decodificados (endereços estáveis)
+    };
+
+    /**
+     * @brief Ids de nome em paralelo; devolve as strings distintas por id - 1
+     */
+    static std::vector<std::string> internNames(const std::vector<std::string_view>& names,
+                                                std::vector<uint32_t>& nameIds, ThreadPool& pool) {
+        const size_t n = names.size();
+        const size_t blocks = std::max<size_t>(1, std::min<size_t>(n / 4096, pool.size() * 4));
+        std::hash<std::string_view> hasher;
+
+        // Índices dos nomes não vazios, por bloco de entrada e por fatia
+        std::vector<std::vector<uint32_t>> buckets(blocks * NAME_SHARDS);
+        pool.parallelFor(blocks, [&](size_t block, unsigned) {
+            size_t begin = n * block / blocks, end = n * (block + 1) / blocks;
+            for (size_t i = begin; i < end; ++i) {
+                if (names[i].empty()) continue;
+                buckets[block * NAME_SHARDS + hasher(names[i]) % NAME_SHARDS].push_back(static_cast<uint32_t>(i));
+            }
+        });
+
+        // Cada fatia elimina repetições e numera localmente
+        std::vector<std::vector<std::string_view>> unique(NAME_SHARDS);
+        pool.parallelFor(NAME_SHARDS, [&](size_t shard, unsigned) {
+            size_t expected = 0;
+            for (size_t block = 0; block < blocks; ++block) expected += buckets[block * NAME_SHARDS + shard].size();
+            std::unordered_map<std::string_view, uint32_t> lookup;
+            lookup.reserve(expected);
+            unique[shard].reserve(expected);
+            for (size_t block = 0; block < blocks; ++block) {
+                for (uint32_t i : buckets[block * NAME_SHARDS + shard]) {
+                    auto [it, inserted] = lookup.emplace(names[i], static_cast<uint32_t>(unique[shard].size()));
+                    if (inserted) unique[shard].push_back(names[i]);
+                    nameIds[i] = it->second;
+                }
+            }
+        });
+
+        std::vector<size_t> first(NAME_SHARDS + 1, 0);
+        for (size_t shard = 0; shard < NAME_SHARDS; ++shard) first[shard + 1] = first[shard] + unique[shard].size();
+        std::vector<std::string> strings(first[NAME_SHARDS]);
+        pool.parallelFor(NAME_SHARDS, [&](size_t shard, unsigned) {
+            for (size_t u = 0; u < unique[shard].size(); ++u) strings[first[shard] + u] = std::string(unique[shard][u]);
+            uint32_t base = static_cast<uint32_t>(first[shard] + 1);    // id 0 = nome vazio
+            for (size_t block = 0; block < blocks; ++block) {
+                for (uint32_t i : buckets[block * NAME_SHARDS + shard]) nameIds[i] += base;
+            }
+        });
+        return strings;
+    }
+
+public:
+    /**
+     * @brief Carrega o arquivo para o grafo, substituindo seus pontos
+     * @param threads Threads (0 = hardware_concurrency())
+     * @throws TSPException com o número da primeira linha inválida
+     */
+    template <typename Format>
+    static IngestStats load(const std::string& path, Graph& graph, unsigned threads = 0) {
+        auto start = Clock::now();
+        MappedFile file(path);
+        double mapMs = elapsedMs(start);
+        IngestStats stats = parse<Format>(file.begin(), file.end(), graph, threads);
+        stats.mapMs = mapMs;
+        return stats;
+    }
+
+    /// Carrega a partir de um texto já em memória
+    template <typename Format>
+    static IngestStats parse(const char* begin, const char* end, Graph& graph, unsigned threads = 0) {
+        IngestStats stats;
+        auto start = Clock::now();
+        ThreadPool pool(threads);
+        const size_t bytes = static_cast<size_t>(end - begin);
+        stats.bytes = bytes;
+        stats.threads = pool.size();
+
+        // 1-2. Blocos terminados em '\n' e contagem de linhas
+        size_t chunkCount = std::max<size_t>(1, std::min<size_t>(bytes / MIN_CHUNK_BYTES, pool.size() * 4));
+        std::vector<Chunk> chunks(chunkCount);
+        const char* cursor = begin;
+        for (size_t c = 0; c < chunkCount; ++c) {
+            const char* stop = c + 1 == chunkCount ? end : std::max(cursor, begin + bytes * (c + 1) / chunkCount);
+            while (stop < end && stop[-1] != '\n') ++stop;
+            chunks[c].begin = cursor;
+            chunks[c].end = stop;
+            cursor = stop;
+        }
+        pool.parallelFor(chunkCount, [&](size_t c, unsigned) {
+            Chunk& chunk = chunks[c];
+            size_t lines = 0;
+            for (const char* p = chunk.begin; p < chunk.end;) {
+                const void* found = std::memchr(p, '\n', static_cast<size_t>(chunk.end - p));
+                if (!found) break;
+                ++lines;
+                p = static_cast<const char*>(found) + 1;
+            }
+            bool unterminated = chunk.end > chunk.begin && chunk.end[-1] != '\n';
+            chunk.capacity = lines + (unterminated ? 1 : 0);
+        });
+        size_t capacity = 0;
+        for (Chunk& chunk : chunks) {
+            chunk.offset = capacity;
+            capacity += chunk.capacity;
+        }
+        stats.splitMs = elapsedMs(start);
+
+        // 3. Conversão direta para os arrays finais
+        AlignedVector<double> xs(capacity), ys(capacity);
+        std::vector<std::string_view> names(capacity);
+        pool.parallelFor(chunkCount, [&](size_t c, unsigned) {
+            Chunk& chunk = chunks[c];
+            PointFields fields;
+            std::string scratch;
+            size_t index = chunk.offset;
+            for (const char* line = chunk.begin; line < chunk.end;) {
+                const char* stop = static_cast<const char*>(std::memchr(line, '\n', static_cast<size_t>(chunk.end - line)));
+                if (!stop) stop = chunk.end;
+                scratch.clear();
+                LineStatus status = Format::parse(line, stop, fields, scratch);
+                if (status == LineStatus::Point) {
+                    xs[index] = fields.x;
+                    ys[index] = fields.y;
+                    if (!scratch.empty() && fields.name.data() == scratch.data()) {
+                        chunk.decoded.push_back(scratch);
+                        fields.name = chunk.decoded.back();
+                    }
+                    names[index++] = fields.name;
+                } else if (status == LineStatus::Invalid && !(Format::HEADER_LINE && line == begin)) {
+                    chunk.error = line;
+                    break;
+                }
+                line = stop + 1;
+            }
+            chunk.count = index - chunk.offset;
+        });
+        for (const Chunk& chunk : chunks) {
+            if (chunk.error) {
+                size_t line = 1 + static_cast<size_t>(std::count(begin, chunk.error, '\n'));
+                throw TSPException(std::string(Format::NAME) + " line " + std::to_string(line) + ": invalid point");
+            }
+        }
+
+        // Linhas puladas deixam buracos no fim de cada bloco: compacta
+        size_t total = chunks[0].count;
+        for (size_t c = 1; c < chunkCount; ++c) {
+            const Chunk& chunk = chunks[c];
+            if (chunk.offset != total) {
+                std::memmove(xs.data() + total, xs.data() + chunk.offset, chunk.count * sizeof(double));
+                std::memmove(ys.data() + total, ys.data() + chunk.offset, chunk.count * sizeof(double));
+                std::copy(names.begin() + chunk.offset, names.begin() + chunk.offset + chunk.count,
+                          names.begin() + total);
+            }
+            total += chunk.count;
+        }
+        xs.resize(total);
+        ys.resize(total);
+        names.resize(total);
+        stats.records = total;
+        stats.parseMs = elapsedMs(start);
+
+        // 4. Tabela de nomes
+        std::vector<uint32_t> nameIds(total, 0);
+        StringTable table;
+        table.assignUnique(internNames(names, nameIds, pool));
+        stats.internMs = elapsedMs(start);
+
+        // 5. Entrega ao grafo
+        graph.assignPoints(std::move(xs), std::move(ys), std::move(nameIds), std::move(table));
+        stats.assignMs = elapsedMs(start);
+        return stats;
+    }
+};
+
+#endif // POINTINGEST_H
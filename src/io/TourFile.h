@@ -0,0 +1,201 @@
+#ifndef TOURFILE_H
+#define TOURFILE_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include <algorithm>
+
+#include "core/Graph.h"
+#include "core/Route.h"
+#include "core/TSPException.h"
+#include "io/MappedFile.h"
+#include "io/OutputBuffer.h"
+#include "io/TspbFile.h"
+
+/**
+ * @brief Gravação de rotas: TSPLIB .tour, CSV e permutação binária .tourb
+ *
+ * As cidades são gravadas na numeração original do Graph (ordem de
+ * inserção, ver Graph::getOriginalId), então a rota corresponde às linhas
+ * do arquivo de entrada mesmo depois de Graph::renumber. Toda a saída
+ * passa por OutputBuffer: nenhuma cópia da sequência nem string
+ * temporária é criada, de modo que a gravação de rotas com milhões de
+ * cidades é limitada pelo disco.
+ *
+ * - .tour: TOUR_SECTION com ids a partir de 1, terminada por -1 e EOF;
+ * - .csv: "index,name,distance" na ordem de visita, com a distância
+ *   acumulada; com 3 ou mais cidades a última linha repete a primeira
+ *   (retorno), de modo que a última distância é o comprimento da rota;
+ * - .tourb: cabeçalho de 64 bytes, ids uint32 (a partir de 0) e uma soma
+ *   de verificação (Checksum64) do cabeçalho e dos ids; lido por readBinary.
+ */
+class TourFile {
+public:
+    enum class Format { Tsplib, Csv, Binary };
+
+private:
+    static constexpr char MAGIC[8] = {'T', 'O', 'U', 'R', '\r', '\n', '\x1A', '\n'};
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint64_t count;
+        double length;
+        uint8_t reserved[32];
+    };
+    static_assert(sizeof(Header) == 64, "Header layout must be 64 bytes");
+
+    static const Graph& graphOf(const Route& route) {
+        if (!route.getGraph()) throw TSPException("Route is not bound to a graph");
+        return *route.getGraph();
+    }
+
+    static void putCsvRow(OutputBuffer& out, const Graph& graph, uint32_t index, double distance) {
+        out.putUnsigned(graph.getOriginalId(index));
+        out.put(',');
+        out.putCsvField(graph.getName(index));
+        out.put(',');
+        out.putDouble(distance);
+        out.put('\n');
+    }
+
+public:
+    static Format formatOf(const std::string& path) {
+        std::string extension;
+        size_t dot = path.find_last_of('.');
+        if (dot != std::string::npos && path.find_first_of("/\\", dot) == std::string::npos) {
+            for (char c : path.substr(dot + 1)) {
+                extension += static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+        }
+        if (extension == "tour") return Format::Tsplib;
+        if (extension == "csv") return Format::Csv;
+        if (extension == "tourb") return Format::Binary;
+        throw TSPException("Unknown tour format: " + path);
+    }
+
+    /**
+     * @brief Grava a rota escolhendo o formato pela extensão
+     * @param name Nome da instância (NAME do .tour)
+     * @return Bytes gravados
+     */
+    static uint64_t write(const std::string& path, const Route& route, const std::string& name = "") {
+        switch (formatOf(path)) {
+            case Format::Tsplib: return writeTsplib(path, route, name);
+            case Format::Csv: return writeCsv(path, route);
+            case Format::Binary: return writeBinary(path, route);
+        }
+        return 0;
+    }
+
+    static uint64_t writeTsplib(const std::string& path, const Route& route, const std::string& name = "") {
+        const Graph& graph = graphOf(route);
+        OutputBuffer out(path);
+        out.put("NAME : ");
+        out.put(name.empty() ? std::string_view("route") : std::string_view(name));
+        out.put(".tour\nCOMMENT : Length = ");
+        out.putDouble(route.getTotalDistance());
+        out.put("\nTYPE : TOUR\nDIMENSION : ");
+        out.putUnsigned(route.size());
+        out.put("\nTOUR_SECTION\n");
+        for (uint32_t index : route.getSequence()) {
+            out.putUnsigned(uint64_t(graph.getOriginalId(index)) + 1);
+            out.put('\n');
+        }
+        out.put("-1\nEOF\n");
+        out.close();
+        return out.bytesWritten();
+    }
+
+    static uint64_t writeCsv(const std::string& path, const Route& route) {
+        const Graph& graph = graphOf(route);
+        const DistanceMatrix& matrix = graph.getDistanceMatrix();
+        const std::vector<uint32_t>& sequence = route.getSequence();
+        OutputBuffer out(path);
+        out.put("index,name,distance\n");
+        double distance = 0.0;
+        for (size_t i = 0; i < sequence.size(); ++i) {
+            if (i > 0) distance += matrix.at(sequence[i - 1], sequence[i]);
+            putCsvRow(out, graph, sequence[i], distance);
+        }
+        if (sequence.size() >= 3) {
+            distance += matrix.at(sequence.back(), sequence.front());
+            putCsvRow(out, graph, sequence.front(), distance);
+        }
+        out.close();
+        return out.bytesWritten();
+    }
+
+    static uint64_t writeBinary(const std::string& path, const Route& route) {
+        const Graph& graph = graphOf(route);
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.byteOrder = BYTE_ORDER_MARK;
+        header.count = route.size();
+        header.length = route.getTotalDistance();
+
+        OutputBuffer out(path);
+        Checksum64 sum;
+        sum.update(&header, sizeof(header));
+        out.putRaw(header);
+        // Traduz em blocos pequenos (na pilha) para somar e gravar de uma vez
+        const std::vector<uint32_t>& sequence = route.getSequence();
+        uint32_t block[1024];
+        for (size_t start = 0; start < sequence.size(); start += 1024) {
+            size_t count = std::min<size_t>(1024, sequence.size() - start);
+            for (size_t i = 0; i < count; ++i) block[i] = graph.getOriginalId(sequence[start + i]);
+            sum.update(block, count * sizeof(uint32_t));
+            out.write(block, count * sizeof(uint32_t));
+        }
+        out.putRaw(sum.digest());
+        out.close();
+        return out.bytesWritten();
+    }
+
+    /**
+     * @brief Lê uma rota .tourb
+     * @param length Se não nulo, recebe o comprimento gravado
+     * @return Ids originais na ordem de visita (uma permutação de 0..n-1)
+     * @throws TSPException se o arquivo estiver truncado ou corrompido
+     */
+    static std::vector<uint32_t> readBinary(const std::string& path, double* length = nullptr) {
+        MappedFile file(path);
+        Header header;
+        if (file.size() < sizeof(Header) + sizeof(uint64_t)) throw TSPException("Not a .tourb file: " + path);
+        std::memcpy(&header, file.data(), sizeof(Header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) throw TSPException("Not a .tourb file: " + path);
+        if (header.byteOrder != BYTE_ORDER_MARK) throw TSPException("Unsupported byte order in " + path);
+        if (header.version != VERSION) throw TSPException("Unsupported .tourb version in " + path);
+        const uint64_t body = file.size() - sizeof(Header) - sizeof(uint64_t);
+        if (body % sizeof(uint32_t) != 0 || body / sizeof(uint32_t) != header.count) {
+            throw TSPException("Truncated .tourb file: " + path);
+        }
+
+        const size_t payload = sizeof(Header) + header.count * sizeof(uint32_t);
+        Checksum64 sum;
+        sum.update(file.data(), payload);
+        uint64_t stored;
+        std::memcpy(&stored, file.data() + payload, sizeof(stored));
+        if (sum.digest() != stored) throw TSPException("Checksum mismatch in " + path);
+
+        std::vector<uint32_t> ids(header.count);
+        if (!ids.empty()) std::memcpy(ids.data(), file.data() + sizeof(Header), ids.size() * sizeof(uint32_t));
+        std::vector<bool> seen(ids.size(), false);
+        for (uint32_t id : ids) {
+            if (id >= ids.size() || seen[id]) throw TSPException("Tour is not a permutation in " + path);
+            seen[id] = true;
+        }
+        if (length) *length = header.length;
+        return ids;
+    }
+};
+
+#endif // TOURFILE_H
@@ -0,0 +1,362 @@
+#ifndef TSPBFILE_H
+#define TSPBFILE_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+#include "core/Graph.h"
+#include "core/CandidateLists.h"
+#include "core/TSPException.h"
+#include "io/MappedFile.h"
+
+/**
+ * @brief Soma de verificação de 64 bits, incremental
+ *
+ * Quatro acumuladores independentes processam blocos de 32 bytes (no
+ * estilo do xxHash64, sem compatibilidade com ele), então a verificação
+ * roda a vários GB/s e não pesa na abertura de arquivos grandes.
+ */
+class Checksum64 {
+private:
+    static constexpr uint64_t P1 = 0x9E3779B185EBCA87ULL;
+    static constexpr uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr uint64_t P3 = 0x165667B19E3779F9ULL;
+
+    uint64_t m_lanes[4] = {P1 + P2, P2, 0, 0 - P1};
+    uint64_t m_total = 0;
+    unsigned char m_pending[32];
+    size_t m_pendingSize = 0;
+
+    static uint64_t rotl(uint64_t v, int r) { return (v << r) | (v >> (64 - r)); }
+
+    void block(const unsigned char* data) {
+        for (int lane = 0; lane < 4; ++lane) {
+            uint64_t word;
+            std::memcpy(&word, data + 8 * lane, sizeof(word));
+            m_lanes[lane] = rotl(m_lanes[lane] + word * P2, 31) * P1;
+        }
+    }
+
+public:
+    void update(const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        m_total += size;
+        if (m_pendingSize > 0) {
+            size_t take = std::min(size, 32 - m_pendingSize);
+            std::memcpy(m_pending + m_pendingSize, bytes, take);
+            m_pendingSize += take;
+            bytes += take;
+            size -= take;
+            if (m_pendingSize < 32) return;
+            block(m_pending);
+            m_pendingSize = 0;
+        }
+        for (; size >= 32; bytes += 32, size -= 32) block(bytes);
+        std::memcpy(m_pending, bytes, size);
+        m_pendingSize = size;
+    }
+
+    uint64_t digest() const {
+        uint64_t h = rotl(m_lanes[0], 1) + rotl(m_lanes[1], 7) + rotl(m_lanes[2], 12) + rotl(m_lanes[3], 18);
+        h ^= m_total * P3;
+        for (size_t i = 0; i < m_pendingSize; ++i) h = rotl(h ^ (m_pending[i] * P1), 11) * P2;
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        return h ^ (h >> 32);
+    }
+};
+
+/**
+ * @brief Cabeçalho de um arquivo .tspb carregado
+ */
+struct TspbInfo {
+    uint32_t version = 0;
+    size_t count = 0;
+    size_t neighborCount = 0;        ///< 0 = sem listas de vizinhos
+    bool hasNames = false;
+    DistanceMetric metric = DistanceMetric::Euclidean;
+    size_t fileSize = 0;
+};
+
+/**
+ * @brief Formato binário de instâncias (.tspb), aberto sem parsing nem cópia
+ *
+ * Layout (little-endian), com cada seção alinhada a 64 bytes:
+ * - cabeçalho de 128 bytes (Header);
+ * - x[count] e y[count] em double;
+ * - opcional: listas de vizinhos, count x neighborCount uint32, em ordem
+ *   crescente de distância;
+ * - opcional: nomes, count + 1 deslocamentos uint64 seguidos dos bytes.
+ *
+ * A soma de verificação (Checksum64) cobre o cabeçalho, com o campo
+ * checksum zerado, e o resto do arquivo. open() mapeia o arquivo e entrega
+ * os ponteiros ao Graph (Graph::attachMapped): coordenadas e vizinhos são
+ * lidos direto das páginas mapeadas, compartilhadas entre processos que
+ * abrem o mesmo arquivo, e o mapeamento vive enquanto o grafo o usar.
+ *
+ * Instâncias com matriz explícita não são suportadas.
+ */
+class TspbFile {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr size_t ALIGNMENT = 64;
+
+private:
+    static constexpr char MAGIC[8] = {'T', 'S', 'P', 'B', '\r', '\n', 0x1A, '\n'};
+    static constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    static constexpr uint32_t HAS_NAMES = 1;
+    static constexpr uint32_t HAS_NEIGHBORS = 2;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t headerSize;
+        uint32_t flags;
+        uint64_t count;
+        uint32_t metric;
+        uint32_t neighborCount;
+        uint64_t xOffset;
+        uint64_t yOffset;
+        uint64_t neighborsOffset;
+        uint64_t nameOffsetsOffset;
+        uint64_t nameCharsOffset;
+        uint64_t nameCharsSize;
+        uint64_t fileSize;
+        uint64_t checksum;
+        uint8_t reserved[24];
+    };
+    static_assert(sizeof(Header) == 128, "Header layout must be 128 bytes");
+
+    static uint64_t alignUp(uint64_t offset) { return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT; }
+
+    /// Saída que acumula a soma de verificação e a posição
+    struct Writer {
+        std::ofstream& out;
+        Checksum64 sum;
+        uint64_t position = 0;
+
+        explicit Writer(std::ofstream& stream) : out(stream) {}
+
+        void put(const void* data, size_t size) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            sum.update(data, size);
+            position += size;
+        }
+
+        /// Completa com zeros até o início da próxima seção
+        void padTo(uint64_t offset) {
+            static const char zeros[ALIGNMENT] = {};
+            while (position < offset) {
+                put(zeros, static_cast<size_t>(std::min<uint64_t>(offset - position, ALIGNMENT)));
+            }
+        }
+    };
+
+    /**
+     * @brief Confere o conteúdo que o grafo indexa sem verificação de limites
+     *
+     * Vizinhos devem ser índices válidos (< count) e diferentes da própria
+     * cidade; os deslocamentos dos nomes devem ser crescentes e não passar
+     * de nameCharsSize. Feito uma vez na abertura, mesmo sem checksum, para
+     * que um arquivo corrompido não vire leitura fora do mapeamento.
+     */
+    static bool sectionsValid(const char* base, const Header& header, bool hasNeighbors, bool hasNames) {
+        const uint64_t n = header.count;
+        if (hasNeighbors) {
+            const uint64_t k = header.neighborCount;
+            const uint32_t* neighbors = reinterpret_cast<const uint32_t*>(base + header.neighborsOffset);
+            for (uint64_t i = 0; i < n; ++i) {
+                const uint32_t* row = neighbors + i * k;
+                for (uint64_t j = 0; j < k; ++j) {
+                    if (row[j] >= n || row[j] == i) return false;
+                }
+            }
+        }
+        if (hasNames) {
+            const uint64_t* offsets = reinterpret_cast<const uint64_t*>(base + header.nameOffsetsOffset);
+            if (offsets[0] != 0 || offsets[n] != header.nameCharsSize) return false;
+            for (uint64_t i = 0; i < n; ++i) {
+                if (offsets[i] > offsets[i + 1]) return false;
+            }
+        }
+        return true;
+    }
+
+    static bool fits(uint64_t offset, uint64_t size, uint64_t fileSize) {
+        return offset <= fileSize && size <= fileSize - offset;
+    }
+
+public:
+    /**
+     * @brief Grava o grafo no formato .tspb
+     * @param path Arquivo de saída
+     * @param graph Pontos (na ordem atual, ver Graph::renumber)
+     * @param neighborCount Vizinhos pré-calculados por cidade (0 = nenhum)
+     * @param threads Threads para as listas de vizinhos (0 = hardware_concurrency())
+     */
+    static void write(const std::string& path, const Graph& graph, size_t neighborCount = 10,
+                      unsigned threads = 0) {
+        const DistanceMetric metric = graph.getDistanceConfig().metric;
+        if (metric == DistanceMetric::Explicit) {
+            throw TSPException("Explicit distance matrices cannot be stored in .tspb");
+        }
+        const size_t n = graph.size();
+
+        CandidateLists candidates;
+        if (neighborCount > 0 && n > 1) candidates.build(graph, neighborCount, threads);
+        const size_t k = candidates.k();
+
+        // Nomes só são gravados se algum não for vazio
+        std::vector<uint64_t> nameOffsets;
+        bool hasNames = false;
+        for (size_t i = 0; i < n && !hasNames; ++i) hasNames = !graph.getName(i).empty();
+        if (hasNames) {
+            nameOffsets.resize(n + 1, 0);
+            for (size_t i = 0; i < n; ++i) nameOffsets[i + 1] = nameOffsets[i] + graph.getName(i).size();
+        }
+
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.byteOrder = BYTE_ORDER_MARK;
+        header.headerSize = sizeof(Header);
+        header.flags = (hasNames ? HAS_NAMES : 0) | (k > 0 ? HAS_NEIGHBORS : 0);
+        header.count = n;
+        header.metric = static_cast<uint32_t>(metric);
+        header.neighborCount = static_cast<uint32_t>(k);
+        header.xOffset = alignUp(sizeof(Header));
+        header.yOffset = alignUp(header.xOffset + n * sizeof(double));
+        uint64_t end = header.yOffset + n * sizeof(double);
+        if (k > 0) {
+            header.neighborsOffset = alignUp(end);
+            end = header.neighborsOffset + n * k * sizeof(uint32_t);
+        }
+        if (hasNames) {
+            header.nameOffsetsOffset = alignUp(end);
+            header.nameCharsOffset = header.nameOffsetsOffset + (n + 1) * sizeof(uint64_t);
+            header.nameCharsSize = nameOffsets[n];
+            end = header.nameCharsOffset + header.nameCharsSize;
+        }
+        header.fileSize = end;
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) throw TSPException("Cannot create file: " + path);
+        std::vector<char> buffer(1 << 20);
+        out.rdbuf()->pubsetbuf(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        Writer writer(out);
+        writer.put(&header, sizeof(header));
+        writer.padTo(header.xOffset);
+        writer.put(graph.xData(), n * sizeof(double));
+        writer.padTo(header.yOffset);
+        writer.put(graph.yData(), n * sizeof(double));
+        if (k > 0) {
+            writer.padTo(header.neighborsOffset);
+            for (uint32_t i = 0; i < n; ++i) writer.put(candidates.of(i), k * sizeof(uint32_t));
+        }
+        if (hasNames) {
+            writer.padTo(header.nameOffsetsOffset);
+            writer.put(nameOffsets.data(), nameOffsets.size() * sizeof(uint64_t));
+            for (size_t i = 0; i < n; ++i) {
+                const std::string& name = graph.getName(i);
+                writer.put(name.data(), name.size());
+            }
+        }
+
+        header.checksum = writer.sum.digest();
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.flush();
+        if (!out) throw TSPException("Cannot write file: " + path);
+    }
+
+    /**
+     * @brief Abre o arquivo mapeado e passa os pontos ao grafo, sem cópia
+     * @param verifyChecksum false para confiar no arquivo e não ler tudo na abertura
+     * @throws TSPException se o arquivo for inválido ou estiver corrompido
+     */
+    static TspbInfo open(const std::string& path, Graph& graph, bool verifyChecksum = true) {
+        auto file = std::make_shared<MappedFile>(path, false);
+        if (file->size() < sizeof(Header)) throw TSPException("Not a .tspb file: " + path);
+
+        Header header;
+        std::memcpy(&header, file->data(), sizeof(header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+            throw TSPException("Not a .tspb file: " + path);
+        }
+        if (header.byteOrder != BYTE_ORDER_MARK) throw TSPException("Unsupported .tspb byte order");
+        if (header.version != VERSION || header.headerSize != sizeof(Header)) {
+            throw TSPException("Unsupported .tspb version " + std::to_string(header.version));
+        }
+        if (header.metric > static_cast<uint32_t>(DistanceMetric::Att)) {
+            throw TSPException("Invalid .tspb distance metric");
+        }
+
+        const uint64_t size = file->size();
+        const uint64_t n = header.count;
+        const uint64_t k = header.neighborCount;
+        bool hasNames = header.flags & HAS_NAMES;
+        bool hasNeighbors = header.flags & HAS_NEIGHBORS;
+        bool valid = header.fileSize == size && n <= UINT32_MAX &&
+            header.xOffset % ALIGNMENT == 0 && header.yOffset % ALIGNMENT == 0 &&
+            fits(header.xOffset, n * sizeof(double), size) && fits(header.yOffset, n * sizeof(double), size);
+        if (hasNeighbors) {
+            valid = valid && k > 0 && k < n && header.neighborsOffset % ALIGNMENT == 0 &&
+                    fits(header.neighborsOffset, n * k * sizeof(uint32_t), size);
+        }
+        if (hasNames) {
+            valid = valid && header.nameOffsetsOffset % sizeof(uint64_t) == 0 &&
+                    fits(header.nameOffsetsOffset, (n + 1) * sizeof(uint64_t), size) &&
+                    fits(header.nameCharsOffset, header.nameCharsSize, size);
+        }
+        if (!valid) throw TSPException("Corrupted .tspb header: " + path);
+        if (!sectionsValid(file->data(), header, hasNeighbors, hasNames)) {
+            throw TSPException("Corrupted .tspb data: " + path);
+        }
+
+        if (verifyChecksum) {
+            Header zeroed = header;
+            zeroed.checksum = 0;
+            Checksum64 sum;
+            sum.update(&zeroed, sizeof(zeroed));
+            sum.update(file->data() + sizeof(Header), size - sizeof(Header));
+            if (sum.digest() != header.checksum) throw TSPException("Checksum mismatch in " + path);
+        }
+
+        const char* base = file->data();
+        Graph::MappedPoints points;
+        points.x = reinterpret_cast<const double*>(base + header.xOffset);
+        points.y = reinterpret_cast<const double*>(base + header.yOffset);
+        points.count = static_cast<size_t>(n);
+        if (hasNeighbors) {
+            points.neighbors = reinterpret_cast<const uint32_t*>(base + header.neighborsOffset);
+            points.neighborCount = static_cast<size_t>(k);
+        }
+        if (hasNames) {
+            points.nameOffsets = reinterpret_cast<const uint64_t*>(base + header.nameOffsetsOffset);
+            points.nameChars = base + header.nameCharsOffset;
+        }
+        points.metric = static_cast<DistanceMetric>(header.metric);
+        points.owner = file;
+        graph.attachMapped(std::move(points));
+
+        TspbInfo info;
+        info.version = header.version;
+        info.count = static_cast<size_t>(n);
+        info.neighborCount = hasNeighbors ? static_cast<size_t>(k) : 0;
+        info.hasNames = hasNames;
+        info.metric = static_cast<DistanceMetric>(header.metric);
+        info.fileSize = static_cast<size_t>(size);
+        return info;
+    }
+};
+
+#endif // TSPBFILE_H
@@ -0,0 +1,283 @@
+#ifndef TSPLIBREADER_H
+#define TSPLIBREADER_H
+
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <charconv>
+#include <algorithm>
+
+#include "core/Graph.h"
+#include "core/TSPException.h"
+#include "io/MappedFile.h"
+
+/**
+ * @brief Cabeçalho de uma instância TSPLIB carregada
+ */
+struct TsplibInfo {
+    std::string name;
+    std::string comment;
+    std::string edgeWeightType;      ///< EUC_2D, CEIL_2D, GEO, ATT ou EXPLICIT
+    std::string edgeWeightFormat;    ///< Só para EXPLICIT (FULL_MATRIX, UPPER_ROW, ...)
+    size_t dimension = 0;
+    DistanceMetric metric = DistanceMetric::Euclidean;
+    bool hasDisplayData = false;     ///< Coordenadas vieram de DISPLAY_DATA_SECTION
+};
+
+/**
+ * @brief Leitor de instâncias TSPLIB (.tsp) simétricas
+ *
+ * Suporta NODE_COORD_SECTION com EDGE_WEIGHT_TYPE EUC_2D, CEIL_2D, GEO e
+ * ATT, e EXPLICIT com EDGE_WEIGHT_SECTION em qualquer formato triangular
+ * ou FULL_MATRIX (DISPLAY_DATA_SECTION, se houver, dá as coordenadas de
+ * exibição; senão as cidades são postas em um círculo).
+ *
+ * O arquivo é mapeado em memória (MappedFile) e lido em uma passada, com
+ * std::from_chars e sem std::string por linha. Os arrays finais são
+ * alocados uma vez com DIMENSION elementos e movidos para o Graph por
+ * Graph::assignPoints, sem a verificação de duplicatas de addPoint
+ * (instâncias TSPLIB podem repetir coordenadas). A métrica TSPLIB fica na
+ * configuração da matriz do grafo, então os comprimentos das rotas batem
+ * com os ótimos publicados.
+ *
+ * O nome de cada cidade é o seu número no arquivo (1..n) e o índice no
+ * grafo é número - 1.
+ */
+class TsplibReader {
+private:
+    const char* m_begin;
+    const char* m_pos;
+    const char* m_end;
+
+    TsplibReader(const char* begin, const char* end) : m_begin(begin), m_pos(begin), m_end(end) {}
+
+    [[noreturn]] void fail(const std::string& message) const {
+        size_t line = 1 + static_cast<size_t>(std::count(m_begin, m_pos, '\n'));
+        throw TSPException("TSPLIB line " + std::to_string(line) + ": " + message);
+    }
+
+    static bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+    static bool isSpace(char c) { return isBlank(c) || c == '\n'; }
+
+    void skipBlanks() { while (m_pos < m_end && isBlank(*m_pos)) ++m_pos; }
+    void skipSpaces() { while (m_pos < m_end && isSpace(*m_pos)) ++m_pos; }
+    void skipLine() {
+        while (m_pos < m_end && *m_pos != '\n') ++m_pos;
+        if (m_pos < m_end) ++m_pos;
+    }
+
+    /// Próxima palavra (até espaço, fim de linha ou ':')
+    std::string keyword() {
+        skipSpaces();
+        const char* start = m_pos;
+        while (m_pos < m_end && !isSpace(*m_pos) && *m_pos != ':') ++m_pos;
+        return std::string(start, m_pos);
+    }
+
+    /// Valor após "CHAVE :" até o fim da linha, sem espaços nas pontas
+    std::string value() {
+        skipBlanks();
+        if (m_pos < m_end && *m_pos == ':') ++m_pos;
+        skipBlanks();
+        const char* start = m_pos;
+        while (m_pos < m_end && *m_pos != '\n') ++m_pos;
+        const char* stop = m_pos;
+        while (stop > start && isBlank(stop[-1])) --stop;
+        if (m_pos < m_end) ++m_pos;
+        return std::string(start, stop);
+    }
+
+    /// Token numérico: retorna [início, fim) sem consumir o '+' inicial
+    std::pair<const char*, const char*> token() {
+        skipSpaces();
+        if (m_pos == m_end) fail("unexpected end of file");
+        const char* start = m_pos;
+        while (m_pos < m_end && !isSpace(*m_pos)) ++m_pos;
+        if (*start == '+') ++start;
+        return {start, m_pos};
+    }
+
+    double number() {
+        auto [start, stop] = token();
+        double result;
+        auto parsed = std::from_chars(start, stop, result);
+        if (parsed.ec != std::errc() || parsed.ptr != stop) fail("invalid number '" + std::string(start, stop) + "'");
+        return result;
+    }
+
+    /// Número da cidade (1..n); o texto do token vira o nome
+    uint32_t nodeId(size_t dimension, std::string& text) {
+        auto [start, stop] = token();
+        uint64_t id = 0;
+        auto parsed = std::from_chars(start, stop, id);
+        if (parsed.ec != std::errc() || parsed.ptr != stop || id == 0 || id > dimension) {
+            fail("invalid node id '" + std::string(start, stop) + "'");
+        }
+        text.assign(start, stop);
+        return static_cast<uint32_t>(id - 1);
+    }
+
+    static DistanceMetric metricFor(const std::string& type) {
+        if (type == "EUC_2D") return DistanceMetric::Euc2D;
+        if (type == "CEIL_2D") return DistanceMetric::Ceil2D;
+        if (type == "GEO") return DistanceMetric::Geo;
+        if (type == "ATT") return DistanceMetric::Att;
+        if (type == "EXPLICIT") return DistanceMetric::Explicit;
+        throw TSPException("Unsupported TSPLIB EDGE_WEIGHT_TYPE: " + type);
+    }
+
+    void readCoordinates(size_t n, AlignedVector<double>& x, AlignedVector<double>& y,
+                         std::vector<uint32_t>& nameIds, StringTable& names) {
+        std::vector<uint8_t> seen(n, 0);
+        std::string text;
+        for (size_t count = 0; count < n; ++count) {
+            uint32_t index = nodeId(n, text);
+            if (seen[index]) fail("duplicate node " + text);
+            seen[index] = 1;
+            x[index] = number();
+            y[index] = number();
+            skipBlanks();
+            if (m_pos < m_end && *m_pos != '\n') skipLine();   // NODE_COORD_TYPE THREED_COORDS
+            nameIds[index] = names.intern(text);
+        }
+    }
+
+    void readEdgeWeights(size_t n, const std::string& format, std::vector<double>& cells) {
+        cells.assign(n * n, 0.0);
+        auto set = [&](size_t i, size_t j) {
+            double w = number();
+            cells[i * n + j] = w;
+            cells[j * n + i] = w;
+        };
+        // Formatos por coluna de uma matriz simétrica equivalem ao formato
+        // por linha do triângulo oposto
+        if (format == "FULL_MATRIX") {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < n; ++j) cells[i * n + j] = number();
+        } else if (format == "UPPER_ROW" || format == "LOWER_COL") {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = i + 1; j < n; ++j) set(i, j);
+        } else if (format == "LOWER_ROW" || format == "UPPER_COL") {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < i; ++j) set(i, j);
+        } else if (format == "UPPER_DIAG_ROW" || format == "LOWER_DIAG_COL") {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = i; j < n; ++j) set(i, j);
+        } else if (format == "LOWER_DIAG_ROW" || format == "UPPER_DIAG_COL") {
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j <= i; ++j) set(i, j);
+        } else {
+            fail("unsupported EDGE_WEIGHT_FORMAT " + format);
+        }
+        for (size_t i = 0; i < n; ++i) cells[i * n + i] = 0.0;
+    }
+
+    TsplibInfo read(Graph& graph) {
+        TsplibInfo info;
+        AlignedVector<double> x, y;
+        std::vector<uint32_t> nameIds;
+        std::vector<double> weights;
+        StringTable names;
+        bool hasCoordinates = false, hasWeights = false;
+
+        auto allocate = [&]() {
+            if (info.dimension == 0) fail("DIMENSION must precede the data sections");
+            if (x.empty()) {
+                x.assign(info.dimension, 0.0);
+                y.assign(info.dimension, 0.0);
+                nameIds.assign(info.dimension, 0);
+            }
+        };
+
+        for (;;) {
+            std::string key = keyword();
+            if (key.empty() || key == "EOF") break;
+
+            if (key == "NAME") info.name = value();
+            else if (key == "COMMENT") info.comment = value();
+            else if (key == "TYPE") {
+                std::string type = value();
+                if (type.compare(0, 3, "TSP") != 0) {
+                    throw TSPException("Unsupported TSPLIB TYPE: " + type);
+                }
+            } else if (key == "DIMENSION") {
+                std::string text = value();
+                uint64_t dimension = 0;
+                auto parsed = std::from_chars(text.data(), text.data() + text.size(), dimension);
+                if (parsed.ec != std::errc() || dimension < 1 || dimension > UINT32_MAX) {
+                    fail("invalid DIMENSION " + text);
+                }
+                info.dimension = static_cast<size_t>(dimension);
+            } else if (key == "EDGE_WEIGHT_TYPE") {
+                info.edgeWeightType = value();
+                info.metric = metricFor(info.edgeWeightType);
+            } else if (key == "EDGE_WEIGHT_FORMAT") info.edgeWeightFormat = value();
+            else if (key == "NODE_COORD_SECTION" || key == "DISPLAY_DATA_SECTION") {
+                skipLine();
+                allocate();
+                readCoordinates(info.dimension, x, y, nameIds, names);
+                hasCoordinates = true;
+                if (key == "DISPLAY_DATA_SECTION") info.hasDisplayData = true;
+            } else if (key == "EDGE_WEIGHT_SECTION") {
+                skipLine();
+                allocate();
+                readEdgeWeights(info.dimension, info.edgeWeightFormat, weights);
+                hasWeights = true;
+            } else if (key.size() > 8 && key.compare(key.size() - 8, 8, "_SECTION") == 0) {
+                fail("unsupported section " + key);
+            } else {
+                value();    // chaves que não afetam a instância (CAPACITY, NODE_COORD_TYPE, ...)
+            }
+        }
+
+        if (info.edgeWeightType.empty()) throw TSPException("TSPLIB file without EDGE_WEIGHT_TYPE");
+        bool isExplicit = info.metric == DistanceMetric::Explicit;
+        if (isExplicit && !hasWeights) throw TSPException("TSPLIB file without EDGE_WEIGHT_SECTION");
+        if (!isExplicit && !hasCoordinates) throw TSPException("TSPLIB file without NODE_COORD_SECTION");
+
+        if (!hasCoordinates) {
+            // Sem coordenadas de exibição: cidades em um círculo
+            allocate();
+            const double PI = 3.14159265358979323846;
+            const double radius = 100.0 * std::sqrt(static_cast<double>(info.dimension));
+            for (size_t i = 0; i < info.dimension; ++i) {
+                double angle = 2.0 * PI * static_cast<double>(i) / static_cast<double>(info.dimension);
+                x[i] = radius * std::cos(angle);
+                y[i] = radius * std::sin(angle);
+                nameIds[i] = names.intern(std::to_string(i + 1));
+            }
+        }
+
+        graph.assignPoints(std::move(x), std::move(y), std::move(nameIds), std::move(names));
+        if (isExplicit) {
+            graph.setExplicitDistances(std::move(weights));
+        } else {
+            DistanceMatrix::Config config = graph.getDistanceConfig();
+            config.metric = info.metric;
+            graph.setDistanceConfig(config);
+        }
+        return info;
+    }
+
+public:
+    /**
+     * @brief Carrega a instância para o grafo, substituindo seus pontos
+     * @param path Caminho do arquivo .tsp
+     * @param graph Grafo de destino (limpo antes da carga)
+     * @return Cabeçalho da instância
+     * @throws TSPException se o arquivo não existir ou for inválido
+     */
+    static TsplibInfo load(const std::string& path, Graph& graph) {
+        MappedFile file(path);
+        return parse(file.begin(), file.end(), graph);
+    }
+
+    /// Carrega a partir de um texto já em memória
+    static TsplibInfo parse(const char* begin, const char* end, Graph& graph) {
+        TsplibReader reader(begin, end);
+        return reader.read(graph);
+    }
+};
+
+#endif // TSPLIBREADER_H
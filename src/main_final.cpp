@@ -5,239 +5,30 @@
 #include <memory>
 #include <string>
 #include <chrono>
+#include <limits>
+#include <cstdlib>
 
-// ================= CLASSES BASE =================
-
-class Point {
-private:
-    double x, y;
-    std::string name;
-
-public:
-    Point(double x = 0, double y = 0, const std::string& name = "") 
-        : x(x), y(y), name(name) {}
-    
-    double getX() const { return x; }
-    double getY() const { return y; }
-    std::string getName() const { return name; }
-    
-    void setX(double newX) { x = newX; }
-    void setY(double newY) { y = newY; }
-    void setName(const std::string& newName) { name = newName; }
-    
-    double distanceTo(const Point& other) const {
-        double dx = x - other.x;
-        double dy = y - other.y;
-        return std::sqrt(dx * dx + dy * dy);
-    }
-    
-    bool operator==(const Point& other) const {
-        const double EPSILON = 1e-9;
-        return std::abs(x - other.x) < EPSILON && std::abs(y - other.y) < EPSILON;
-    }
-    
-    bool operator<(const Point& other) const {
-        return (x < other.x) || (x == other.x && y < other.y);
-    }
-    
-    friend std::ostream& operator<<(std::ostream& os, const Point& p) {
-        os << "Point(" << p.x << ", " << p.y << ", \"" << p.name << "\")";
-        return os;
-    }
-};
-
-class TSPException : public std::exception {
-private:
-    std::string message;
-public:
-    TSPException(const std::string& msg) : message(msg) {}
-    const char* what() const noexcept override { return message.c_str(); }
-};
-
-class Route {
-private:
-    std::vector<Point> points;
-    double totalDistance;
-    
-    void calculateDistance() {
-        totalDistance = 0.0;
-        if (points.size() < 2) return;
-        
-        for (size_t i = 0; i < points.size() - 1; ++i) {
-            totalDistance += points[i].distanceTo(points[i + 1]);
-        }
-        // Retorno ao início para fechar o ciclo
-        if (points.size() >= 3) {
-            totalDistance += points.back().distanceTo(points.front());
-        }
-    }
-
-public:
-    Route() : totalDistance(0.0) {}
-    
-    Route(const std::vector<Point>& pts) : points(pts) {
-        calculateDistance();
-    }
-    
-    void addPoint(const Point& point) {
-        points.push_back(point);
-        calculateDistance();
-    }
-    
-    size_t size() const { return points.size(); }
-    Point getPoint(size_t index) const { 
-        if (index >= points.size()) throw TSPException("Index out of bounds");
-        return points[index]; 
-    }
-    double getTotalDistance() const { return totalDistance; }
-    std::vector<Point> getPoints() const { return points; }
-    
-    bool operator<(const Route& other) const {
-        return totalDistance < other.totalDistance;
-    }
-    
-    friend std::ostream& operator<<(std::ostream& os, const Route& route) {
-        os << "Route[" << route.points.size() << " points, distance=" 
-           << route.totalDistance << "]: ";
-        for (size_t i = 0; i < route.points.size(); ++i) {
-            if (i > 0) os << " -> ";
-            os << route.points[i].getName();
-        }
-        if (route.points.size() >= 3) {
-            os << " -> " << route.points[0].getName();
-        }
-        return os;
-    }
-};
-
-class Graph {
-private:
-    std::vector<Point> points;
-
-public:
-    void addPoint(const Point& point) {
-        // Verificar duplicatas
-        for (const auto& p : points) {
-            if (p == point) {
-                throw TSPException("Point already exists");
-            }
-        }
-        points.push_back(point);
-    }
-    
-    Point getPoint(size_t index) const {
-        if (index >= points.size()) throw TSPException("Index out of bounds");
-        return points[index];
-    }
-    
-    size_t size() const { return points.size(); }
-    std::vector<Point> getAllPoints() const { return points; }
-    
-    double getDistance(size_t from, size_t to) const {
-        return getPoint(from).distanceTo(getPoint(to));
-    }
-    
-    friend std::ostream& operator<<(std::ostream& os, const Graph& graph) {
-        os << "Graph[" << graph.points.size() << " points]";
-        return os;
-    }
-};
-
-// ================= ALGORITMOS TSP =================
-
-class TSPAlgorithm {
-protected:
-    long lastExecutionTime;
-
-public:
-    TSPAlgorithm() : lastExecutionTime(0) {}
-    virtual ~TSPAlgorithm() {}
-    
-    virtual Route solve(const Graph& graph) = 0;
-    virtual std::string getName() const = 0;
-    virtual std::string getDescription() const = 0;
-    
-    long getLastExecutionTime() const { return lastExecutionTime; }
-};
-
-class NearestNeighborTSP : public TSPAlgorithm {
-public:
-    Route solve(const Graph& graph) override {
-        auto start = std::chrono::high_resolution_clock::now();
-        
-        if (graph.size() < 2) throw TSPException("Need at least 2 points");
-        
-        Route route;
-        std::vector<bool> visited(graph.size(), false);
-        
-        // Começar do primeiro ponto
-        size_t current = 0;
-        route.addPoint(graph.getPoint(current));
-        visited[current] = true;
-        
-        // Visitar pontos mais próximos
-        while (route.size() < graph.size()) {
-            double minDist = 1e9;
-            size_t nextPoint = 0;
-            
-            for (size_t i = 0; i < graph.size(); ++i) {
-                if (!visited[i]) {
-                    double dist = graph.getDistance(current, i);
-                    if (dist < minDist) {
-                        minDist = dist;
-                        nextPoint = i;
-                    }
-                }
-            }
-            
-            current = nextPoint;
-            route.addPoint(graph.getPoint(current));
-            visited[current] = true;
-        }
-        
-        auto end = std::chrono::high_resolution_clock::now();
-        lastExecutionTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        return route;
-    }
-    
-    std::string getName() const override { return "Nearest Neighbor"; }
-    std::string getDescription() const override { 
-        return "Greedy algorithm that selects nearest unvisited city"; 
-    }
-};
-
-class BruteForceTSP : public TSPAlgorithm {
-public:
-    Route solve(const Graph& graph) override {
-        auto start = std::chrono::high_resolution_clock::now();
-        
-        if (graph.size() < 2) throw TSPException("Need at least 2 points");
-        if (graph.size() > 8) throw TSPException("Brute force only for small graphs");
-        
-        std::vector<Point> points = graph.getAllPoints();
-        Route bestRoute(points);
-        
-        // Gerar todas as permutações
-        std::sort(points.begin(), points.end());
-        do {
-            Route current(points);
-            if (current < bestRoute) {
-                bestRoute = current;
-            }
-        } while (std::next_permutation(points.begin(), points.end()));
-        
-        auto end = std::chrono::high_resolution_clock::now();
-        lastExecutionTime = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
-        
-        return bestRoute;
-    }
-    
-    std::string getName() const override { return "Brute Force"; }
-    std::string getDescription() const override { 
-        return "Exhaustive search through all permutations"; 
-    }
-};
+#include "core/Point.h"
+#include "core/Graph.h"
+#include "core/Route.h"
+#include "core/TSPException.h"
+#include "core/TSPAlgorithm.h"
+#include "algorithms/NearestNeighborTSP.h"
+#include "algorithms/BruteForceTSP.h"
+#include "algorithms/HeldKarpTSP.h"
+#include "algorithms/TwoOptTSP.h"
+#include "algorithms/LocalSearchTSP.h"
+#include "algorithms/LinKernighanTSP.h"
+#include "algorithms/GeneticTSP.h"
+#include "algorithms/SimulatedAnnealingTSP.h"
+#include "algorithms/AntColonyTSP.h"
+#include "algorithms/HilbertCurveTSP.h"
+#include "algorithms/GreedyEdgeTSP.h"
+#include "algorithms/InsertionTSP.h"
+#include "algorithms/ClarkeWrightTSP.h"
+#include "algorithms/SpanningTreeTSP.h"
+#include "io/InstanceReader.h"
+#include "cli/BatchSolver.h"
 
 // ================= DEMO PRINCIPAL =================
 
@@ -249,6 +40,22 @@ public:
     TSPDemo() {
         algorithms.push_back(std::make_unique<NearestNeighborTSP>());
         algorithms.push_back(std::make_unique<BruteForceTSP>());
+        algorithms.push_back(std::make_unique<HeldKarpTSP>());
+        algorithms.push_back(std::make_unique<TwoOptTSP>());
+        algorithms.push_back(std::make_unique<LocalSearchTSP>());
+        algorithms.push_back(std::make_unique<LinKernighanTSP>());
+        algorithms.push_back(std::make_unique<GeneticTSP>());
+        algorithms.push_back(std::make_unique<SimulatedAnnealingTSP>());
+        algorithms.push_back(std::make_unique<AntColonyTSP>());
+        algorithms.push_back(std::make_unique<HilbertCurveTSP>());
+        algorithms.push_back(std::make_unique<GreedyEdgeTSP>());
+        algorithms.push_back(std::make_unique<CheapestInsertionTSP>());
+        algorithms.push_back(std::make_unique<NearestInsertionTSP>());
+        algorithms.push_back(std::make_unique<FarthestInsertionTSP>());
+        algorithms.push_back(std::make_unique<ConvexHullInsertionTSP>());
+        algorithms.push_back(std::make_unique<ClarkeWrightTSP>());
+        algorithms.push_back(std::make_unique<DoubleTreeTSP>());
+        algorithms.push_back(std::make_unique<ChristofidesTSP>());
     }
     
     void run() {
@@ -276,7 +83,42 @@ public:
         printFooter();
     }
     
+    /**
+     * @brief Converte uma instância (.tsp, .csv ou .jsonl) para o formato binário .tspb
+     */
+    static bool convertInstance(const std::string& input, const std::string& output, size_t neighborCount) {
+        try {
+            Graph graph;
+            auto start = std::chrono::steady_clock::now();
+            IngestStats stats;
+            InstanceReader::load(input, graph, &stats);
+            auto loaded = std::chrono::steady_clock::now();
+            TspbFile::write(output, graph, neighborCount);
+            auto written = std::chrono::steady_clock::now();
+            
+            std::cout << "💾 " << input << " → " << output << " (" << graph.size() << " cidades, "
+                      << neighborCount << " vizinhos)" << std::endl;
+            std::cout << "   ⏱️  Leitura: " << std::chrono::duration<double, std::milli>(loaded - start).count()
+                      << "ms, gravação: " << std::chrono::duration<double, std::milli>(written - loaded).count()
+                      << "ms" << std::endl;
+            if (stats.records > 0) printIngestStats(stats);
+            return true;
+        } catch (const TSPException& e) {
+            std::cerr << "❌ Erro TSP: " << e.what() << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Erro: " << e.what() << std::endl;
+        }
+        return false;
+    }
+    
 private:
+    static void printIngestStats(const IngestStats& stats) {
+        std::cout << "   📥 " << stats.bytes / 1e6 << " MB em " << stats.threads << " threads ("
+                  << stats.megabytesPerSecond() << " MB/s): mapear " << stats.mapMs
+                  << "ms, dividir " << stats.splitMs << "ms, converter " << stats.parseMs
+                  << "ms, nomes " << stats.internMs << "ms, grafo " << stats.assignMs << "ms" << std::endl;
+    }
+    
     void printHeader() {
         std::cout << "╔══════════════════════════════════════════════════════════════╗\n";
         std::cout << "║                    TSP ROUTE OPTIMIZER                      ║\n";
@@ -372,6 +214,32 @@ private:
             
             std::cout << "   ✅ " << result << std::endl;
             std::cout << "   ⏱️  Tempo: " << algo->getLastExecutionTime() << "ms" << std::endl;
+            if (auto* bruteForce = dynamic_cast<BruteForceTSP*>(algo.get())) {
+                std::cout << "   🔎 Nós explorados: " << bruteForce->getNodesExplored() << std::endl;
+            }
+            if (auto* genetic = dynamic_cast<GeneticTSP*>(algo.get())) {
+                std::cout << "   🧬 Gerações: " << genetic->getGenerations() << " ("
+                          << genetic->getGenerationsPerSecond() << "/s)" << std::endl;
+            }
+            if (auto* annealing = dynamic_cast<SimulatedAnnealingTSP*>(algo.get())) {
+                std::cout << "   🌡️  Movimentos: " << annealing->getMovesAccepted() << "/"
+                          << annealing->getMovesTried() << " aceitos ("
+                          << annealing->getMovesPerSecond() << "/s), trocas "
+                          << annealing->getSwapsAccepted() << "/" << annealing->getSwapsTried() << std::endl;
+            }
+            if (auto* colony = dynamic_cast<AntColonyTSP*>(algo.get())) {
+                std::cout << "   🐜 Iterações: " << colony->getIterations() << " (média "
+                          << colony->getAverageIterationTime() << "ms)" << std::endl;
+            }
+            if (auto* spanningTree = dynamic_cast<SpanningTreeTSP*>(algo.get())) {
+                std::cout << "   🌲 Limite inferior (MST): " << spanningTree->getTree().getWeight() << std::endl;
+            }
+            if (auto* localSearch = dynamic_cast<LocalSearchTSP*>(algo.get())) {
+                for (const auto& stats : localSearch->getMoveStats()) {
+                    std::cout << "   🔧 " << stats.name << ": " << stats.accepted << "/"
+                              << stats.attempts << " aceitos (ganho " << stats.gain << ")" << std::endl;
+                }
+            }
         }
         
         // Comparação
@@ -401,7 +269,38 @@ private:
     }
 };
 
-int main() {
+int main(int argc, char** argv) {
+    // Uso: tsp_optimizer --convert entrada.(tsp|csv|jsonl) saida.tspb [vizinhos]
+    if (argc > 1 && std::string(argv[1]) == "--convert") {
+        if (argc < 4 || argc > 5) {
+            std::cerr << "Uso: " << argv[0] << " --convert entrada.(tsp|csv|jsonl) saida.tspb [vizinhos]" << std::endl;
+            return 2;
+        }
+        size_t neighbors = 10;
+        try {
+            if (argc > 4) neighbors = static_cast<size_t>(CommandLine::parseNumber("neighbor count", argv[4]));
+        } catch (const TSPException& e) {
+            std::cerr << "❌ Erro: " << e.what() << std::endl;
+            return 2;
+        }
+        return TSPDemo::convertInstance(argv[2], argv[3], neighbors) ? 0 : 1;
+    }
+    if (argc > 1) {
+        // Uso: tsp_optimizer [opções] entrada... (ver CommandLine::usage)
+        try {
+            BatchOptions options = CommandLine::parse(argc, argv);
+            if (options.help) {
+                std::cout << CommandLine::usage(argv[0]);
+                return 0;
+            }
+            BatchSolver solver(std::move(options));
+            return solver.run(std::cout) == 0 ? 0 : 1;
+        } catch (const std::exception& e) {
+            std::cerr << "❌ Erro: " << e.what() << "\n\n" << CommandLine::usage(argv[0]);
+            return 2;
+        }
+    }
+
     std::cout << "TSP Route Optimizer - Etapa 2 CLI\n";
     std::cout << "Desenvolvido por: Erick Batista da Silva\n";
     std::cout << "Disciplina: Programação Orientada a Objetos (C++)\n\n";
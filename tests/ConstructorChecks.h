@@ -0,0 +1,128 @@
+#ifndef CONSTRUCTORCHECKS_H
+#define CONSTRUCTORCHECKS_H
+
+#include <memory>
+#include <string>
+#include <functional>
+#include <unordered_map>
+
+#include "TestSupport.h"
+#include "core/TSPAlgorithm.h"
+#include "io/TsplibReader.h"
+
+/**
+ * @brief Verificações comuns aos algoritmos construtivos
+ *
+ * checkConstructor roda o algoritmo em grafos pequenos (2 a 8 cidades), em
+ * entradas degeneradas (pontos coincidentes, colineares, poucas posições
+ * repetidas), em métricas que não seguem as coordenadas (GEO e matriz
+ * explícita sem desigualdade triangular) e com neighbor_count = 0. A rota
+ * deve ser uma permutação e o comprimento informado deve ser o da
+ * sequência devolvida.
+ */
+using AlgorithmFactory = std::function<std::unique_ptr<TSPAlgorithm>()>;
+
+/// Soma das arestas do ciclo, direto da matriz
+inline double cycleLength(const Route& route) {
+    const DistanceMatrix& dist = route.getGraph()->getDistanceMatrix();
+    const std::vector<uint32_t>& sequence = route.getSequence();
+    double length = 0.0;
+    for (size_t i = 0; i + 1 < sequence.size(); ++i) length += dist.at(sequence[i], sequence[i + 1]);
+    if (sequence.size() > 2) length += dist.at(sequence.back(), sequence.front());
+    return length;
+}
+
+inline void checkRoute(const std::string& name, const AlgorithmFactory& create, const Graph& graph,
+                       const std::string& label, const std::unordered_map<std::string, double>& extra = {}) {
+    std::unique_ptr<TSPAlgorithm> algorithm = create();
+    std::unordered_map<std::string, double> params = {{"threads", 1}, {"time_limit_ms", 20}};
+    for (const auto& [key, value] : extra) params[key] = value;
+    algorithm->setParameters(params);
+    try {
+        Route route = algorithm->solve(graph);
+        if (!isPermutation(route, graph.size())) {
+            testFail(__FILE__, __LINE__, name + " on " + label + ": not a permutation");
+            return;
+        }
+        double expected = cycleLength(route);
+        if (std::abs(route.getTotalDistance() - expected) > 1e-6 * std::max(1.0, expected)) {
+            testFail(__FILE__, __LINE__, name + " on " + label + ": length " +
+                     std::to_string(route.getTotalDistance()) + " != " + std::to_string(expected));
+        }
+    } catch (const std::exception& e) {
+        testFail(__FILE__, __LINE__, name + " on " + label + ": " + e.what());
+    }
+}
+
+inline void addPoints(Graph& graph, const std::vector<std::pair<double, double>>& coordinates) {
+    std::vector<Point> points;
+    for (size_t i = 0; i < coordinates.size(); ++i) {
+        points.emplace_back(coordinates[i].first, coordinates[i].second, "P" + std::to_string(i));
+    }
+    graph.addPoints(points, true);
+}
+
+inline void checkSmallInputs(const std::string& name, const AlgorithmFactory& create) {
+    std::mt19937 rng(3);
+    for (size_t n = 2; n <= 8; ++n) {
+        Graph graph;
+        randomPoints(graph, n, rng);
+        checkRoute(name, create, graph, std::to_string(n) + " random points");
+    }
+    Graph graph;
+    randomPoints(graph, 200, rng);
+    checkRoute(name, create, graph, "200 random points");
+    checkRoute(name, create, graph, "200 random points, neighbor_count 0", {{"neighbor_count", 0}});
+}
+
+inline void checkDegenerateInputs(const std::string& name, const AlgorithmFactory& create) {
+    for (size_t n : {2, 3, 5, 40}) {
+        Graph coincident;
+        addPoints(coincident, std::vector<std::pair<double, double>>(n, {7.0, 7.0}));
+        checkRoute(name, create, coincident, std::to_string(n) + " coincident points");
+    }
+
+    std::vector<std::pair<double, double>> horizontal, vertical, diagonal, repeated;
+    for (int i = 0; i < 30; ++i) {
+        horizontal.push_back({i * 3.0, 5.0});
+        vertical.push_back({-2.0, (i * 7) % 30});
+        diagonal.push_back({i, i});
+        repeated.push_back({(i % 4) * 10.0, (i % 4) * 10.0 + (i % 2)});
+    }
+    for (const auto& [label, coordinates] : {std::make_pair("horizontal line", horizontal),
+                                             std::make_pair("vertical line", vertical),
+                                             std::make_pair("diagonal line", diagonal),
+                                             std::make_pair("few distinct positions", repeated)}) {
+        Graph graph;
+        addPoints(graph, coordinates);
+        checkRoute(name, create, graph, label);
+    }
+}
+
+inline void checkNonCoordinateMetrics(const std::string& name, const AlgorithmFactory& create) {
+    std::mt19937 rng(41);
+    for (size_t n : {3, 4, 25, 120}) {
+        Graph graph;
+        randomPoints(graph, n, rng);
+        graph.setExplicitDistances(randomMatrix(n, false, rng));
+        checkRoute(name, create, graph, "non-metric matrix n=" + std::to_string(n));
+    }
+
+    const std::string text =
+        "NAME: burma14\nTYPE: TSP\nDIMENSION: 14\nEDGE_WEIGHT_TYPE: GEO\nNODE_COORD_SECTION\n"
+        "1 16.47 96.10\n2 16.47 94.44\n3 20.09 92.54\n4 22.39 93.37\n5 25.23 97.24\n"
+        "6 22.00 96.05\n7 20.47 97.02\n8 17.20 96.29\n9 16.30 97.38\n10 14.05 98.12\n"
+        "11 16.53 97.38\n12 21.52 95.59\n13 19.41 97.13\n14 20.09 94.55\nEOF\n";
+    Graph burma;
+    TsplibReader::parse(text.data(), text.data() + text.size(), burma);
+    checkRoute(name, create, burma, "burma14 (GEO)");
+}
+
+/// Todas as verificações acima, cada grupo como um caso
+inline void checkConstructor(const std::string& name, const AlgorithmFactory& create) {
+    runCase(name + ": small inputs", [&] { checkSmallInputs(name, create); });
+    runCase(name + ": degenerate inputs", [&] { checkDegenerateInputs(name, create); });
+    runCase(name + ": non-coordinate metrics", [&] { checkNonCoordinateMetrics(name, create); });
+}
+
+#endif // CONSTRUCTORCHECKS_H
@@ -0,0 +1,96 @@
+#ifndef TESTSUPPORT_H
+#define TESTSUPPORT_H
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <iostream>
+
+#include "core/Graph.h"
+#include "core/Route.h"
+
+/**
+ * @brief Verificações mínimas para os testes (sem framework externo)
+ *
+ * CHECK registra a falha com arquivo e linha e continua, para que uma
+ * execução mostre todos os problemas; main() devolve testFailures() como
+ * código de saída, que é o que o ctest avalia.
+ */
+inline int& testFailures() {
+    static int failures = 0;
+    return failures;
+}
+
+inline void testFail(const char* file, int line, const std::string& message) {
+    ++testFailures();
+    std::cerr << file << ":" << line << ": " << message << std::endl;
+}
+
+#define CHECK(condition) \
+    do { if (!(condition)) testFail(__FILE__, __LINE__, "CHECK(" #condition ") failed"); } while (0)
+
+#define CHECK_NEAR(actual, expected, tolerance) \
+    do { \
+        double a_ = (actual), e_ = (expected); \
+        if (!(std::abs(a_ - e_) <= (tolerance))) { \
+            testFail(__FILE__, __LINE__, #actual " = " + std::to_string(a_) + ", expected " + std::to_string(e_)); \
+        } \
+    } while (0)
+
+/// Executa um caso; exceções viram falhas com o nome do caso
+template <typename Body>
+void runCase(const std::string& name, Body body) {
+    try {
+        body();
+    } catch (const std::exception& e) {
+        testFail(__FILE__, __LINE__, name + ": unexpected exception: " + e.what());
+    }
+}
+
+/// true se a rota visita cada cidade do grafo exatamente uma vez
+inline bool isPermutation(const Route& route, size_t n) {
+    if (route.size() != n) return false;
+    std::vector<uint8_t> seen(n, 0);
+    for (uint32_t city : route.getSequence()) {
+        if (city >= n || seen[city]) return false;
+        seen[city] = 1;
+    }
+    return true;
+}
+
+/// Pontos aleatórios em [0, 1000)², sem verificação de duplicatas
+inline void randomPoints(Graph& graph, size_t n, std::mt19937& rng) {
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    std::vector<Point> points;
+    for (size_t i = 0; i < n; ++i) {
+        points.emplace_back(coordinate(rng), coordinate(rng), "P" + std::to_string(i));
+    }
+    graph.addPoints(points, true);
+}
+
+/**
+ * @brief Matriz explícita aleatória simétrica (n x n)
+ * @param metric true: distâncias euclidianas de pontos ocultos (vale a
+ *        desigualdade triangular); false: pesos inteiros independentes
+ */
+inline std::vector<double> randomMatrix(size_t n, bool metric, std::mt19937& rng) {
+    std::vector<double> cells(n * n, 0.0);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    std::uniform_int_distribution<int> weight(1, 1000);
+    std::vector<double> x(n), y(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = coordinate(rng);
+        y[i] = coordinate(rng);
+    }
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = i + 1; j < n; ++j) {
+            double d = metric ? std::hypot(x[i] - x[j], y[i] - y[j]) : weight(rng);
+            cells[i * n + j] = cells[j * n + i] = d;
+        }
+    }
+    return cells;
+}
+
+#endif // TESTSUPPORT_H
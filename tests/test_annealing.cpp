@@ -0,0 +1,38 @@
+/**
+ * @brief SimulatedAnnealingTSP: verificações de construtivo e limite de tempo
+ *
+ * O annealing passa pelas verificações de ConstructorChecks.h (como
+ * melhoria ele está em test_improvers), e um time_limit_ms nulo ou
+ * negativo deve ser recusado em vez de devolver a rota inicial.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/SimulatedAnnealingTSP.h"
+
+namespace {
+
+void testTimeLimit() {
+    std::mt19937 rng(31);
+    Graph graph;
+    randomPoints(graph, 40, rng);
+    for (long limit : {0L, -5L}) {
+        SimulatedAnnealingTSP annealing;
+        annealing.setParameters({{"time_limit_ms", static_cast<double>(limit)}});
+        bool rejected = false;
+        try {
+            annealing.solve(graph);
+        } catch (const TSPException&) {
+            rejected = true;
+        }
+        CHECK(rejected);
+    }
+}
+
+} // namespace
+
+int main() {
+    checkConstructor("sa", [] { return std::make_unique<SimulatedAnnealingTSP>(); });
+    runCase("time limit", testTimeLimit);
+    if (testFailures() == 0) std::cout << "test_annealing: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
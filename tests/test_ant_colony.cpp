@@ -0,0 +1,16 @@
+/**
+ * @brief AntColonyTSP: verificações de construtivo
+ *
+ * A colônia passa pelas verificações de ConstructorChecks.h, inclusive
+ * neighbor_count = 0 e matrizes explícitas, em que as listas de
+ * candidatos não vêm das coordenadas.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/AntColonyTSP.h"
+
+int main() {
+    checkConstructor("aco", [] { return std::make_unique<AntColonyTSP>(); });
+    if (testFailures() == 0) std::cout << "test_ant_colony: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
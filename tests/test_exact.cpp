@@ -0,0 +1,109 @@
+/**
+ * @brief Algoritmos exatos: BruteForceTSP e HeldKarpTSP devem concordar
+ *
+ * Cobre métricas com desigualdade triangular (euclidiana, EUC_2D, matriz
+ * explícita euclidiana) e matrizes explícitas sem ela, que são as que
+ * quebram podas baseadas na desigualdade triangular. burma14 (GEO) é
+ * comparado com o ótimo publicado da TSPLIB.
+ */
+
+#include "TestSupport.h"
+#include "algorithms/BruteForceTSP.h"
+#include "algorithms/HeldKarpTSP.h"
+#include "io/TsplibReader.h"
+
+namespace {
+
+/// Resolve com os dois algoritmos e compara os comprimentos
+void crossCheck(const Graph& graph, const std::string& label) {
+    BruteForceTSP brute(12, 1);
+    HeldKarpTSP heldKarp(size_t(64) << 20, 1);
+    Route exhaustive = brute.solve(graph);
+    Route dynamic = heldKarp.solve(graph);
+    CHECK(isPermutation(exhaustive, graph.size()));
+    CHECK(isPermutation(dynamic, graph.size()));
+    if (std::abs(exhaustive.getTotalDistance() - dynamic.getTotalDistance()) > 1e-6) {
+        testFail(__FILE__, __LINE__, label + ": brute force " + std::to_string(exhaustive.getTotalDistance()) +
+                 " != Held-Karp " + std::to_string(dynamic.getTotalDistance()));
+    }
+}
+
+void testCoordinateMetrics() {
+    std::mt19937 rng(11);
+    for (DistanceMetric metric : {DistanceMetric::Euclidean, DistanceMetric::Euc2D, DistanceMetric::Att}) {
+        for (size_t n = 2; n <= 9; ++n) {
+            Graph graph;
+            randomPoints(graph, n, rng);
+            DistanceMatrix::Config config = graph.getDistanceConfig();
+            config.metric = metric;
+            graph.setDistanceConfig(config);
+            crossCheck(graph, "coordinates n=" + std::to_string(n));
+        }
+    }
+}
+
+void testExplicitMatrices() {
+    std::mt19937 rng(23);
+    for (bool metric : {true, false}) {
+        for (int trial = 0; trial < 40; ++trial) {
+            size_t n = 4 + trial % 7;
+            Graph graph;
+            randomPoints(graph, n, rng);
+            graph.setExplicitDistances(randomMatrix(n, metric, rng));
+            crossCheck(graph, std::string(metric ? "metric" : "non-metric") + " matrix trial " + std::to_string(trial));
+        }
+    }
+}
+
+void testBurma14() {
+    // Ótimo publicado: 3323
+    const std::string text =
+        "NAME: burma14\nTYPE: TSP\nDIMENSION: 14\nEDGE_WEIGHT_TYPE: GEO\nNODE_COORD_SECTION\n"
+        "1 16.47 96.10\n2 16.47 94.44\n3 20.09 92.54\n4 22.39 93.37\n5 25.23 97.24\n"
+        "6 22.00 96.05\n7 20.47 97.02\n8 17.20 96.29\n9 16.30 97.38\n10 14.05 98.12\n"
+        "11 16.53 97.38\n12 21.52 95.59\n13 19.41 97.13\n14 20.09 94.55\nEOF\n";
+    Graph graph;
+    TsplibReader::parse(text.data(), text.data() + text.size(), graph);
+    Route route = HeldKarpTSP(size_t(64) << 20, 1).solve(graph);
+    CHECK(isPermutation(route, 14));
+    CHECK_NEAR(route.getTotalDistance(), 3323.0, 1e-9);
+}
+
+void testHeldKarpMemoryLimit() {
+    std::mt19937 rng(43);
+    Graph graph;
+    randomPoints(graph, 12, rng);
+    // A tabela em double não cabe, a em float cabe
+    const size_t limit = HeldKarpTSP::estimateMemory(12, sizeof(float));
+
+    HeldKarpTSP strict(limit, 1);
+    bool rejected = false;
+    try {
+        strict.solve(graph);
+    } catch (const TSPException&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+
+    HeldKarpTSP approximate(limit, 1);
+    approximate.setAllowFloat(true);
+    Route route = approximate.solve(graph);
+    CHECK(isPermutation(route, 12));
+    CHECK(!approximate.isLastResultExact());
+
+    HeldKarpTSP exact(size_t(64) << 20, 1);
+    exact.setAllowFloat(true);
+    exact.solve(graph);
+    CHECK(exact.isLastResultExact());
+}
+
+} // namespace
+
+int main() {
+    runCase("coordinate metrics", testCoordinateMetrics);
+    runCase("explicit matrices", testExplicitMatrices);
+    runCase("burma14", testBurma14);
+    runCase("Held-Karp memory limit", testHeldKarpMemoryLimit);
+    if (testFailures() == 0) std::cout << "test_exact: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
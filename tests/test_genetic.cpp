@@ -0,0 +1,52 @@
+/**
+ * @brief GeneticTSP: verificações de construtivo e modelo de ilhas
+ *
+ * A população única e o modelo de ilhas passam pelas verificações de
+ * ConstructorChecks.h. As ilhas rodam num pool limitado por "threads";
+ * com a mesma semente e o mesmo número de ilhas, a rota deve ser a mesma
+ * com uma thread (todas as ilhas no mesmo participante) ou com mais
+ * threads do que ilhas.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/GeneticTSP.h"
+
+namespace {
+
+void testIslandsIgnoreThreadCount() {
+    std::mt19937 rng(47);
+    Graph graph;
+    randomPoints(graph, 120, rng);
+    for (unsigned islands : {2u, 5u}) {
+        std::vector<uint32_t> reference;
+        for (unsigned threads : {1u, 2u, 8u}) {
+            GeneticTSP genetic(30, 60);
+            genetic.setParameters({{"islands", static_cast<double>(islands)},
+                                   {"threads", static_cast<double>(threads)},
+                                   {"migration_interval", 5}});
+            Route route = genetic.solve(graph);
+            CHECK(isPermutation(route, graph.size()));
+            CHECK(genetic.getGenerations() == 60);
+            if (reference.empty()) {
+                reference = route.getSequence();
+            } else if (route.getSequence() != reference) {
+                testFail(__FILE__, __LINE__, std::to_string(islands) + " islands: route changes with " +
+                         std::to_string(threads) + " threads");
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    checkConstructor("ga", [] { return std::make_unique<GeneticTSP>(); });
+    checkConstructor("ga islands", [] {
+        auto genetic = std::make_unique<GeneticTSP>();
+        genetic->setParameters({{"islands", 3}});
+        return genetic;
+    });
+    runCase("islands and threads", testIslandsIgnoreThreadCount);
+    if (testFailures() == 0) std::cout << "test_genetic: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
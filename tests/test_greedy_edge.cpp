@@ -0,0 +1,16 @@
+/**
+ * @brief GreedyEdgeTSP: verificações de construtivo
+ *
+ * O greedy edge passa pelas verificações de ConstructorChecks.h; GEO e
+ * matrizes explícitas exercitam a junção dos fragmentos pela matriz,
+ * e neighbor_count = 0 o limite mínimo das listas de candidatos.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/GreedyEdgeTSP.h"
+
+int main() {
+    checkConstructor("greedy", [] { return std::make_unique<GreedyEdgeTSP>(); });
+    if (testFailures() == 0) std::cout << "test_greedy_edge: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+/**
+ * @brief HilbertCurveTSP: verificações de construtivo
+ *
+ * A curva passa pelas verificações de ConstructorChecks.h: pontos
+ * coincidentes e colineares (caixa degenerada) e métricas em que a ordem
+ * da curva não segue as distâncias.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/HilbertCurveTSP.h"
+
+int main() {
+    checkConstructor("hilbert", [] { return std::make_unique<HilbertCurveTSP>(); });
+    if (testFailures() == 0) std::cout << "test_hilbert: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+/**
+ * @brief Melhorias (TSPImprover): rotas válidas entram, rotas válidas saem
+ *
+ * Cada melhoria parte de uma rota construtiva e deve devolver uma
+ * permutação não mais longa que ela; rotas iniciais que não visitam cada
+ * cidade do grafo exatamente uma vez (parciais, com repetição) devem ser
+ * recusadas antes de qualquer estrutura indexada por cidade ser montada.
+ */
+
+#include <memory>
+#include <functional>
+
+#include "TestSupport.h"
+#include "algorithms/NearestNeighborTSP.h"
+#include "algorithms/LocalSearchTSP.h"
+#include "algorithms/LinKernighanTSP.h"
+#include "algorithms/SimulatedAnnealingTSP.h"
+
+namespace {
+
+struct Factory {
+    const char* name;
+    std::function<std::unique_ptr<TSPImprover>()> create;
+};
+
+const std::vector<Factory>& improvers() {
+    static const std::vector<Factory> table = {
+        {"ls", [] { return std::make_unique<LocalSearchTSP>(); }},
+        {"lk", [] { return std::make_unique<LinKernighanTSP>(); }},
+        {"sa", [] { return std::make_unique<SimulatedAnnealingTSP>(nullptr, 20); }},
+    };
+    return table;
+}
+
+void testImproves() {
+    std::mt19937 rng(13);
+    for (size_t n : {2, 3, 4, 5, 8, 300}) {
+        Graph graph;
+        randomPoints(graph, n, rng);
+        Route start = NearestNeighborTSP().solve(graph);
+        for (const Factory& factory : improvers()) {
+            Route route = factory.create()->improve(start);
+            if (!isPermutation(route, n)) {
+                testFail(__FILE__, __LINE__, std::string(factory.name) + ": not a permutation, n=" + std::to_string(n));
+            } else if (route.getTotalDistance() > start.getTotalDistance() + 1e-9) {
+                testFail(__FILE__, __LINE__, std::string(factory.name) + ": longer than the start, n=" + std::to_string(n));
+            }
+        }
+    }
+}
+
+void testRejectsPartialRoutes() {
+    std::mt19937 rng(19);
+    Graph graph;
+    randomPoints(graph, 50, rng);
+    std::vector<uint32_t> partial(20), repeated(50);
+    for (uint32_t i = 0; i < 20; ++i) partial[i] = i;
+    for (uint32_t i = 0; i < 50; ++i) repeated[i] = i;
+    repeated[49] = 0;
+
+    for (const Factory& factory : improvers()) {
+        for (const auto& [label, sequence] : {std::make_pair("partial", partial),
+                                              std::make_pair("repeated", repeated)}) {
+            bool rejected = false;
+            try {
+                factory.create()->improve(Route(graph, sequence));
+            } catch (const TSPException&) {
+                rejected = true;
+            }
+            if (!rejected) testFail(__FILE__, __LINE__, std::string(factory.name) + " accepted a " + label + " route");
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    runCase("improvement", testImproves);
+    runCase("partial routes", testRejectsPartialRoutes);
+    if (testFailures() == 0) std::cout << "test_improvers: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
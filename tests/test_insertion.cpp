@@ -0,0 +1,20 @@
+/**
+ * @brief Heurísticas de inserção: verificações de construtivo
+ *
+ * Nearest, farthest, cheapest e convex hull insertion passam pelas
+ * verificações de ConstructorChecks.h; neighbor_count = 0 cobre o limite
+ * mínimo das listas, e GEO e matrizes explícitas o caminho sem índice
+ * espacial.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/InsertionTSP.h"
+
+int main() {
+    checkConstructor("nearest", [] { return std::make_unique<NearestInsertionTSP>(); });
+    checkConstructor("farthest", [] { return std::make_unique<FarthestInsertionTSP>(); });
+    checkConstructor("cheapest", [] { return std::make_unique<CheapestInsertionTSP>(); });
+    checkConstructor("hull", [] { return std::make_unique<ConvexHullInsertionTSP>(); });
+    if (testFailures() == 0) std::cout << "test_insertion: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
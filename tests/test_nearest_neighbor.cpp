@@ -0,0 +1,34 @@
+/**
+ * @brief NearestNeighborTSP: varredura e k-d tree produzem a mesma rota
+ *
+ * Os três modos passam pelas verificações de ConstructorChecks.h, e em
+ * pontos aleatórios (métrica euclidiana) Mode::KDTree e Mode::Auto acima
+ * do limiar devem devolver exatamente a rota da varredura.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/NearestNeighborTSP.h"
+
+namespace {
+
+void testModesAgree() {
+    std::mt19937 rng(53);
+    for (size_t n : {size_t(50), NearestNeighborTSP::AUTO_KDTREE_THRESHOLD + 100}) {
+        Graph graph;
+        randomPoints(graph, n, rng);
+        std::vector<uint32_t> scan = NearestNeighborTSP(NearestNeighborTSP::Mode::Scan).solve(graph).getSequence();
+        CHECK(NearestNeighborTSP(NearestNeighborTSP::Mode::KDTree).solve(graph).getSequence() == scan);
+        CHECK(NearestNeighborTSP().solve(graph).getSequence() == scan);
+    }
+}
+
+} // namespace
+
+int main() {
+    checkConstructor("nn", [] { return std::make_unique<NearestNeighborTSP>(); });
+    checkConstructor("nn scan", [] { return std::make_unique<NearestNeighborTSP>(NearestNeighborTSP::Mode::Scan); });
+    checkConstructor("nn kd-tree", [] { return std::make_unique<NearestNeighborTSP>(NearestNeighborTSP::Mode::KDTree); });
+    runCase("modes agree", testModesAgree);
+    if (testFailures() == 0) std::cout << "test_nearest_neighbor: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,16 @@
+/**
+ * @brief ClarkeWrightTSP: verificações de construtivo
+ *
+ * O savings passa pelas verificações de ConstructorChecks.h; GEO e
+ * matrizes explícitas exercitam o encadeamento dos caminhos que sobram
+ * pela matriz.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/ClarkeWrightTSP.h"
+
+int main() {
+    checkConstructor("savings", [] { return std::make_unique<ClarkeWrightTSP>(); });
+    if (testFailures() == 0) std::cout << "test_savings: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,17 @@
+/**
+ * @brief Construtivos por árvore geradora: verificações de construtivo
+ *
+ * Christofides e double tree passam pelas verificações de ConstructorChecks.h;
+ * pontos coincidentes e colineares exercitam a MST euclidiana, e GEO e
+ * matrizes explícitas a ligação dos componentes e o emparelhamento pela matriz.
+ */
+
+#include "ConstructorChecks.h"
+#include "algorithms/SpanningTreeTSP.h"
+
+int main() {
+    checkConstructor("christofides", [] { return std::make_unique<ChristofidesTSP>(); });
+    checkConstructor("doubletree", [] { return std::make_unique<DoubleTreeTSP>(); });
+    if (testFailures() == 0) std::cout << "test_spanning_tree: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
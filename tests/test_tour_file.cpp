@@ -0,0 +1,45 @@
+/**
+ * @brief Leitura e escrita de rotas (TourFile)
+ *
+ * Uma rota .tourb é gravada e lida (ida e volta), inclusive a rota vazia.
+ * Os arquivos temporários ficam no diretório de trabalho do teste.
+ */
+
+#include <cstdio>
+
+#include "TestSupport.h"
+#include "algorithms/NearestNeighborTSP.h"
+#include "io/TourFile.h"
+
+namespace {
+
+void testTourbRoundTrip() {
+    std::mt19937 rng(29);
+    const std::string path = "test_tour_file_roundtrip.tourb";
+    Graph graph;
+    randomPoints(graph, 500, rng);
+    graph.renumber(SpaceFillingCurve::Curve::Hilbert, 1);
+    Route route = NearestNeighborTSP().solve(graph);
+    TourFile::write(path, route);
+
+    double length = 0.0;
+    std::vector<uint32_t> ids = TourFile::readBinary(path, &length);
+    CHECK(ids == route.getOriginalSequence());
+    CHECK_NEAR(length, route.getTotalDistance(), 0.0);
+    std::remove(path.c_str());
+
+    // Rota vazia também faz a ida e volta
+    Graph empty;
+    Route none(empty);
+    TourFile::writeBinary(path, none);
+    CHECK(TourFile::readBinary(path).empty());
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+    runCase(".tourb round trip", testTourbRoundTrip);
+    if (testFailures() == 0) std::cout << "test_tour_file: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
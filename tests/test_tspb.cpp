@@ -0,0 +1,83 @@
+/**
+ * @brief Formato binário de instâncias .tspb (TspbFile)
+ *
+ * Instâncias com coordenadas, nomes e listas de candidatos são gravadas e
+ * abertas de volta (ida e volta, em duas métricas), e um arquivo com um
+ * byte alterado deve ser recusado. O arquivo temporário fica no diretório
+ * de trabalho do teste.
+ */
+
+#include <fstream>
+#include <cstdio>
+
+#include "TestSupport.h"
+#include "core/CandidateLists.h"
+#include "io/TspbFile.h"
+
+namespace {
+
+void testTspbRoundTrip() {
+    std::mt19937 rng(17);
+    const std::string path = "test_tspb_roundtrip.tspb";
+    for (DistanceMetric metric : {DistanceMetric::Euclidean, DistanceMetric::Euc2D}) {
+        Graph original;
+        randomPoints(original, 300, rng);
+        DistanceMatrix::Config config = original.getDistanceConfig();
+        config.metric = metric;
+        original.setDistanceConfig(config);
+        TspbFile::write(path, original, 6, 1);
+
+        Graph mapped;
+        TspbInfo info = TspbFile::open(path, mapped);
+        CHECK(info.count == original.size());
+        CHECK(info.neighborCount == 6);
+        CHECK(info.hasNames);
+        CHECK(info.metric == metric);
+        CHECK(mapped.getDistanceConfig().metric == metric);
+
+        bool same = mapped.size() == original.size();
+        for (size_t i = 0; same && i < original.size(); ++i) {
+            same = mapped.getX(i) == original.getX(i) && mapped.getY(i) == original.getY(i) &&
+                   mapped.getName(i) == original.getName(i);
+        }
+        CHECK(same);
+
+        CandidateLists expected(original, 6, 1);
+        const uint32_t* stored = mapped.getStoredNeighbors();
+        CHECK(stored != nullptr);
+        for (size_t i = 0; stored && i < original.size(); ++i) {
+            same = same && std::equal(expected.of(static_cast<uint32_t>(i)), expected.of(static_cast<uint32_t>(i)) + 6,
+                                      stored + i * 6);
+        }
+        CHECK(same);
+        CHECK_NEAR(mapped.getDistance(3, 250), original.getDistance(3, 250), 0.0);
+    }
+
+    // Um byte alterado nas coordenadas: a soma de verificação não bate
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(200);
+        char byte = 0;
+        file.read(&byte, 1);
+        byte = static_cast<char>(byte ^ 0x5A);
+        file.seekp(200);
+        file.write(&byte, 1);
+    }
+    bool rejected = false;
+    try {
+        Graph graph;
+        TspbFile::open(path, graph);
+    } catch (const TSPException&) {
+        rejected = true;
+    }
+    CHECK(rejected);
+    std::remove(path.c_str());
+}
+
+} // namespace
+
+int main() {
+    runCase(".tspb round trip", testTspbRoundTrip);
+    if (testFailures() == 0) std::cout << "test_tspb: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+/**
+ * @brief Leitura de instâncias TSPLIB (TsplibReader)
+ *
+ * Cada EDGE_WEIGHT_FORMAT é gerado a partir da mesma matriz e lido de
+ * volta; as métricas por coordenadas são conferidas em distâncias
+ * conhecidas; e o vizinho mais próximo em Mode::Auto deve dar a rota da
+ * varredura nas métricas arredondadas, em que há empates.
+ */
+
+#include <sstream>
+
+#include "TestSupport.h"
+#include "algorithms/NearestNeighborTSP.h"
+#include "io/TsplibReader.h"
+
+namespace {
+
+/**
+ * @brief Texto TSPLIB EXPLICIT com a matriz no formato pedido
+ *
+ * Formatos *_ROW percorrem linhas e *_COL colunas; UPPER/LOWER escolhem o
+ * triângulo e DIAG inclui a diagonal. Os números são quebrados em linhas
+ * de 5, independentemente das linhas da matriz, como em vários arquivos
+ * da TSPLIB.
+ */
+std::string explicitInstance(const std::vector<double>& cells, size_t n, const std::string& format) {
+    const bool full = format == "FULL_MATRIX";
+    const bool byColumn = format.size() > 4 && format.compare(format.size() - 4, 4, "_COL") == 0;
+    const bool upper = format.compare(0, 5, "UPPER") == 0;
+    const bool diagonal = format.find("_DIAG_") != std::string::npos;
+
+    std::ostringstream text;
+    text << "NAME: matrix\nTYPE: TSP\nDIMENSION: " << n << "\nEDGE_WEIGHT_TYPE: EXPLICIT\n"
+         << "EDGE_WEIGHT_FORMAT: " << format << "\nEDGE_WEIGHT_SECTION\n";
+    size_t written = 0;
+    for (size_t outer = 0; outer < n; ++outer) {
+        for (size_t inner = 0; inner < n; ++inner) {
+            size_t row = byColumn ? inner : outer, column = byColumn ? outer : inner;
+            bool included = full || (row == column ? diagonal : (upper ? row < column : row > column));
+            if (!included) continue;
+            text << cells[row * n + column] << (++written % 5 == 0 ? "\n" : " ");
+        }
+    }
+    text << "\nEOF\n";
+    return text.str();
+}
+
+void testEdgeWeightFormats() {
+    std::mt19937 rng(5);
+    const size_t n = 9;
+    std::vector<double> cells = randomMatrix(n, false, rng);
+    for (const char* format : {"FULL_MATRIX", "UPPER_ROW", "LOWER_ROW", "UPPER_DIAG_ROW", "LOWER_DIAG_ROW",
+                               "UPPER_COL", "LOWER_COL", "UPPER_DIAG_COL", "LOWER_DIAG_COL"}) {
+        std::string text = explicitInstance(cells, n, format);
+        Graph graph;
+        TsplibInfo info = TsplibReader::parse(text.data(), text.data() + text.size(), graph);
+        CHECK(info.edgeWeightFormat == format);
+        CHECK(info.metric == DistanceMetric::Explicit);
+        CHECK(graph.size() == n);
+        const DistanceMatrix& dist = graph.getDistanceMatrix();
+        bool same = true;
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < n; ++j) same = same && dist.at(i, j) == cells[i * n + j];
+        }
+        if (!same) testFail(__FILE__, __LINE__, std::string("matrix differs for ") + format);
+    }
+}
+
+void testCoordinateTypes() {
+    // Distância entre (0, 0) e (3, 4.4): euclidiana 5.325...
+    struct Case { const char* type; double expected; };
+    for (const Case& c : {Case{"EUC_2D", 5.0}, Case{"CEIL_2D", 6.0}, Case{"ATT", 2.0}}) {
+        std::string text = std::string("NAME: t\nDIMENSION: 2\nEDGE_WEIGHT_TYPE: ") + c.type +
+                           "\nNODE_COORD_SECTION\n1 0 0\n2 3 4.4\nEOF\n";
+        Graph graph;
+        TsplibReader::parse(text.data(), text.data() + text.size(), graph);
+        CHECK(graph.size() == 2);
+        CHECK(graph.getName(1) == "2");
+        CHECK_NEAR(graph.getDistance(0, 1), c.expected, 0.0);
+    }
+}
+
+void testRoundedMetricsNearestNeighbor() {
+    // Coordenadas inteiras num grid pequeno: muitos empates depois do arredondamento
+    std::mt19937 rng(37);
+    std::uniform_int_distribution<int> coordinate(0, 300);
+    const size_t n = NearestNeighborTSP::AUTO_KDTREE_THRESHOLD + 500;
+    for (const char* type : {"EUC_2D", "CEIL_2D", "ATT"}) {
+        std::ostringstream text;
+        text << "NAME: grid\nDIMENSION: " << n << "\nEDGE_WEIGHT_TYPE: " << type << "\nNODE_COORD_SECTION\n";
+        for (size_t i = 0; i < n; ++i) text << i + 1 << " " << coordinate(rng) << " " << coordinate(rng) << "\n";
+        text << "EOF\n";
+        std::string data = text.str();
+        Graph graph;
+        TsplibReader::parse(data.data(), data.data() + data.size(), graph);
+        Route automatic = NearestNeighborTSP().solve(graph);
+        Route scan = NearestNeighborTSP(NearestNeighborTSP::Mode::Scan).solve(graph);
+        if (automatic.getSequence() != scan.getSequence()) {
+            testFail(__FILE__, __LINE__, std::string("Auto and Scan differ for ") + type);
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    runCase("EDGE_WEIGHT_FORMAT", testEdgeWeightFormats);
+    runCase("coordinate EDGE_WEIGHT_TYPE", testCoordinateTypes);
+    runCase("nearest neighbor on rounded metrics", testRoundedMetricsNearestNeighbor);
+    if (testFailures() == 0) std::cout << "test_tsplib: ok" << std::endl;
+    return testFailures() == 0 ? 0 : 1;
+}